@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SELECTION_CONTENT_SHM_H
+#define SELECTION_CONTENT_SHM_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "ashmem.h"
+
+namespace OHOS::SelectionFwk {
+constexpr const uint32_t SELECTION_CONTENT_SHM_MAGIC = 0x54434C53; // "SLCT"
+constexpr const uint32_t MAX_SELECTION_CONTENT_SHM_LENGTH = 4 * 1024 * 1024; // 共享内存中选中内容的长度上限（字节）
+constexpr const char *SELECTION_CONTENT_SHM_NAME = "selection_content";
+
+// 共享内存布局：定长头部后紧跟 UTF-8 内容，内容不含结尾 '\0'
+struct SelectionContentShmHeader {
+    uint32_t magic = SELECTION_CONTENT_SHM_MAGIC;
+    uint32_t length = 0;
+};
+
+// 将内容写入新建的共享内存并设为只读，返回由调用方负责关闭的 fd，失败返回 -1
+inline int32_t CreateSelectionContentShm(const std::string& content)
+{
+    if (content.size() > MAX_SELECTION_CONTENT_SHM_LENGTH) {
+        return -1;
+    }
+    SelectionContentShmHeader header;
+    header.length = static_cast<uint32_t>(content.size());
+    int32_t size = static_cast<int32_t>(sizeof(header) + content.size());
+    sptr<Ashmem> ashmem = Ashmem::CreateAshmem(SELECTION_CONTENT_SHM_NAME, size);
+    if (ashmem == nullptr) {
+        return -1;
+    }
+    int32_t fd = -1;
+    if (ashmem->MapReadAndWriteAshmem() && ashmem->WriteToAshmem(&header, sizeof(header), 0) &&
+        (content.empty() || ashmem->WriteToAshmem(content.data(), content.size(), sizeof(header)))) {
+        ashmem->UnmapAshmem();
+        // 收紧保护位后接收方只能只读映射，且无法再放开
+        if (ashmem->SetProtection(PROT_READ)) {
+            fd = dup(ashmem->GetAshmemFd());
+        }
+    }
+    ashmem->UnmapAshmem();
+    ashmem->CloseAshmem();
+    return fd;
+}
+
+// 只读映射共享内存并以指向映射区的视图回调内容，不复制内容；
+// 视图仅在回调期间有效，返回前即解除映射。不接管 fd 的所有权
+inline bool VisitSelectionContentShm(int32_t fd, const std::function<void(std::string_view)>& visitor)
+{
+    if (fd < 0 || !visitor) {
+        return false;
+    }
+    int32_t size = AshmemGetSize(fd);
+    if (size < static_cast<int32_t>(sizeof(SelectionContentShmHeader))) {
+        return false;
+    }
+    void *addr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+    const auto *header = static_cast<const SelectionContentShmHeader *>(addr);
+    bool valid = header->magic == SELECTION_CONTENT_SHM_MAGIC && header->length <= MAX_SELECTION_CONTENT_SHM_LENGTH &&
+        header->length <= static_cast<uint32_t>(size) - sizeof(SelectionContentShmHeader);
+    if (valid) {
+        visitor(std::string_view(static_cast<const char *>(addr) + sizeof(SelectionContentShmHeader),
+            header->length));
+    }
+    munmap(addr, size);
+    return valid;
+}
+
+// 从共享内存 fd 读取内容并复制到 content，不接管 fd 的所有权
+inline bool ReadSelectionContentShm(int32_t fd, std::string& content)
+{
+    return VisitSelectionContentShm(fd, [&content](std::string_view view) { content.assign(view); });
+}
+} // namespace OHOS::SelectionFwk
+
+#endif // SELECTION_CONTENT_SHM_H
@@ -20,16 +20,28 @@
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <vector>
 #include "parcel.h"
 #include "selection_interface.h"
 
 namespace OHOS {
 namespace SelectionFwk {
+constexpr uint32_t MAX_SELECTION_EVENT_BATCH_SIZE = 32; // 单次批量通知的最大事件数
 
 struct SelectionInfoData : public Parcelable {
     SelectionInfo data;
 
     bool ReadFromParcel(Parcel &in)
+    {
+        return ReadSelectionInfo(in, data);
+    }
+
+    bool Marshalling(Parcel &out) const
+    {
+        return WriteSelectionInfo(out, data);
+    }
+
+    static bool ReadSelectionInfo(Parcel &in, SelectionInfo &data)
     {
         data.selectionType = static_cast<SelectionType>(in.ReadInt8());
         data.startDisplayX = in.ReadInt32();
@@ -46,7 +58,7 @@ struct SelectionInfoData : public Parcelable {
         return true;
     }
 
-    bool Marshalling(Parcel &out) const
+    static bool WriteSelectionInfo(Parcel &out, const SelectionInfo &data)
     {
         if (!out.WriteInt8(static_cast<int8_t>(data.selectionType))) {
             return false;
@@ -140,18 +152,26 @@ public:
         return ret;
     }
 
-    static SelectionFocusChangeInfo* Unmarshalling(Parcel& parcel)
+    bool ReadFromParcel(Parcel& parcel)
     {
-        auto focusChangeInfo = new SelectionFocusChangeInfo();
-        bool res = parcel.ReadInt32(focusChangeInfo->windowId_) && parcel.ReadUint64(focusChangeInfo->displayId_) &&
-            parcel.ReadInt32(focusChangeInfo->pid_) && parcel.ReadInt32(focusChangeInfo->uid_) &&
-            parcel.ReadUint32(focusChangeInfo->windowType_) &&
-            parcel.ReadBool(focusChangeInfo->isFocused_);
+        bool res = parcel.ReadInt32(windowId_) && parcel.ReadUint64(displayId_) &&
+            parcel.ReadInt32(pid_) && parcel.ReadInt32(uid_) &&
+            parcel.ReadUint32(windowType_) &&
+            parcel.ReadBool(isFocused_);
         if (!res) {
+            return false;
+        }
+        source_ = static_cast<FocusChangeSource>(parcel.ReadUint32());
+        return true;
+    }
+
+    static SelectionFocusChangeInfo* Unmarshalling(Parcel& parcel)
+    {
+        auto focusChangeInfo = new (std::nothrow) SelectionFocusChangeInfo();
+        if (focusChangeInfo != nullptr && !focusChangeInfo->ReadFromParcel(parcel)) {
             delete focusChangeInfo;
             return nullptr;
         }
-        focusChangeInfo->source_ = static_cast<FocusChangeSource>(parcel.ReadUint32());
         return focusChangeInfo;
     }
 
@@ -172,6 +192,158 @@ public:
     bool isFocused_ = false;
     FocusChangeSource source_ = FocusChangeSource::WindowManager;
 };
+
+enum class SelectionEventType : uint32_t {
+    SELECTION = 0,
+    FOCUS_CHANGE,
+    PANEL_STATE,
+    EVENT_TYPE_COUNT,
+};
+
+// 监听者按位订阅的事件类型
+constexpr uint32_t SelectionEventMask(SelectionEventType type)
+{
+    return 1u << static_cast<uint32_t>(type);
+}
+
+constexpr const uint32_t SELECTION_EVENT_MASK_ALL = SelectionEventMask(SelectionEventType::EVENT_TYPE_COUNT) - 1;
+
+// 批量通知中的单个事件，按 type 只使用对应的字段
+struct SelectionNotifyEvent {
+    SelectionEventType type = SelectionEventType::SELECTION;
+    SelectionInfo selectionInfo;
+    int32_t windowId = -1;
+    uint64_t displayId = 0;
+    int32_t pid = -1;
+    int32_t uid = -1;
+    uint32_t windowType = 1;
+    bool isFocused = false;      // FOCUS_CHANGE：是否获焦；PANEL_STATE：面板是否显示
+    FocusChangeSource source = FocusChangeSource::WindowManager;
+
+    static SelectionNotifyEvent FromSelection(const SelectionInfo &info)
+    {
+        SelectionNotifyEvent event;
+        event.selectionInfo = info;
+        return event;
+    }
+
+    static SelectionNotifyEvent FromFocusChange(const SelectionFocusChangeInfo &info)
+    {
+        SelectionNotifyEvent event;
+        event.type = SelectionEventType::FOCUS_CHANGE;
+        event.windowId = info.windowId_;
+        event.displayId = info.displayId_;
+        event.pid = info.pid_;
+        event.uid = info.uid_;
+        event.windowType = info.windowType_;
+        event.isFocused = info.isFocused_;
+        event.source = info.source_;
+        return event;
+    }
+
+    static SelectionNotifyEvent FromPanelState(int32_t windowId, bool isShowing)
+    {
+        SelectionNotifyEvent event;
+        event.type = SelectionEventType::PANEL_STATE;
+        event.windowId = windowId;
+        event.isFocused = isShowing;
+        return event;
+    }
+};
+
+// 合并窗口内的多个通知，一次跨进程调用送达
+class SelectionEventBatch : public Parcelable {
+public:
+    SelectionEventBatch() = default;
+    ~SelectionEventBatch() = default;
+
+    bool Marshalling(Parcel &parcel) const override
+    {
+        if (events.size() > MAX_SELECTION_EVENT_BATCH_SIZE || !parcel.WriteUint32(events.size())) {
+            return false;
+        }
+        for (const auto &event : events) {
+            if (!WriteEvent(parcel, event)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool ReadFromParcel(Parcel &parcel)
+    {
+        uint32_t size = 0;
+        if (!parcel.ReadUint32(size) || size > MAX_SELECTION_EVENT_BATCH_SIZE) {
+            return false;
+        }
+        // 直接在目标位置反序列化，避免逐个事件的临时对象拷贝
+        events.resize(size);
+        for (auto &event : events) {
+            if (!ReadEvent(parcel, event)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static SelectionEventBatch *Unmarshalling(Parcel &parcel)
+    {
+        SelectionEventBatch *batch = new (std::nothrow) SelectionEventBatch();
+        if (batch != nullptr && !batch->ReadFromParcel(parcel)) {
+            delete batch;
+            batch = nullptr;
+        }
+        return batch;
+    }
+
+    std::vector<SelectionNotifyEvent> events;
+
+private:
+    static bool WriteEvent(Parcel &parcel, const SelectionNotifyEvent &event)
+    {
+        if (!parcel.WriteUint32(static_cast<uint32_t>(event.type))) {
+            return false;
+        }
+        switch (event.type) {
+            case SelectionEventType::SELECTION:
+                return SelectionInfoData::WriteSelectionInfo(parcel, event.selectionInfo);
+            case SelectionEventType::FOCUS_CHANGE:
+                return parcel.WriteInt32(event.windowId) && parcel.WriteUint64(event.displayId) &&
+                    parcel.WriteInt32(event.pid) && parcel.WriteInt32(event.uid) &&
+                    parcel.WriteUint32(event.windowType) && parcel.WriteBool(event.isFocused) &&
+                    parcel.WriteUint32(static_cast<uint32_t>(event.source));
+            case SelectionEventType::PANEL_STATE:
+                return parcel.WriteInt32(event.windowId) && parcel.WriteBool(event.isFocused);
+            default:
+                return false;
+        }
+    }
+
+    static bool ReadEvent(Parcel &parcel, SelectionNotifyEvent &event)
+    {
+        uint32_t type = 0;
+        if (!parcel.ReadUint32(type) || type >= static_cast<uint32_t>(SelectionEventType::EVENT_TYPE_COUNT)) {
+            return false;
+        }
+        event.type = static_cast<SelectionEventType>(type);
+        uint32_t source = 0;
+        switch (event.type) {
+            case SelectionEventType::SELECTION:
+                return SelectionInfoData::ReadSelectionInfo(parcel, event.selectionInfo);
+            case SelectionEventType::FOCUS_CHANGE:
+                if (!(parcel.ReadInt32(event.windowId) && parcel.ReadUint64(event.displayId) &&
+                    parcel.ReadInt32(event.pid) && parcel.ReadInt32(event.uid) &&
+                    parcel.ReadUint32(event.windowType) && parcel.ReadBool(event.isFocused) &&
+                    parcel.ReadUint32(source))) {
+                    return false;
+                }
+                event.source = static_cast<FocusChangeSource>(source);
+                return true;
+            default:
+                return parcel.ReadInt32(event.windowId) && parcel.ReadBool(event.isFocused);
+        }
+    }
+};
 }
 }
 
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SELECTION_WHITESPACE_H
+#define SELECTION_WHITESPACE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace OHOS::SelectionFwk {
+struct CodePointRange {
+    uint32_t first;
+    uint32_t last;
+};
+
+// ASCII 空白：\t \n \v \f \r 与空格
+constexpr const uint64_t ASCII_WHITESPACE_MASK =
+    (1ULL << 0x09) | (1ULL << 0x0A) | (1ULL << 0x0B) | (1ULL << 0x0C) | (1ULL << 0x0D) | (1ULL << 0x20);
+
+// 非 ASCII 的 Unicode White_Space 与不可见格式字符，按起点升序排列且互不重叠
+constexpr const CodePointRange INVISIBLE_CODE_POINT_RANGES[] = {
+    { 0x0085, 0x0085 }, // NEXT LINE
+    { 0x00A0, 0x00A0 }, // NO-BREAK SPACE
+    { 0x00AD, 0x00AD }, // SOFT HYPHEN
+    { 0x061C, 0x061C }, // ARABIC LETTER MARK
+    { 0x1680, 0x1680 }, // OGHAM SPACE MARK
+    { 0x180E, 0x180E }, // MONGOLIAN VOWEL SEPARATOR
+    { 0x2000, 0x200F }, // EN QUAD .. RIGHT-TO-LEFT MARK
+    { 0x2028, 0x202E }, // LINE SEPARATOR .. RIGHT-TO-LEFT OVERRIDE
+    { 0x205F, 0x2064 }, // MEDIUM MATHEMATICAL SPACE .. INVISIBLE PLUS
+    { 0x2066, 0x2069 }, // 双向隔离符
+    { 0x3000, 0x3000 }, // IDEOGRAPHIC SPACE
+    { 0xFEFF, 0xFEFF }, // ZERO WIDTH NO-BREAK SPACE
+};
+
+constexpr bool IsInvisibleCodePoint(uint32_t codePoint)
+{
+    if (codePoint < 0x80) {
+        return codePoint < 0x40 && ((ASCII_WHITESPACE_MASK >> codePoint) & 1) != 0;
+    }
+    for (const auto& range : INVISIBLE_CODE_POINT_RANGES) {
+        if (codePoint < range.first) {
+            return false;
+        }
+        if (codePoint <= range.last) {
+            return true;
+        }
+    }
+    return false;
+}
+
+constexpr const uint32_t MAX_UNICODE_CODE_POINT = 0x10FFFF;
+constexpr const uint32_t SURROGATE_FIRST = 0xD800;
+constexpr const uint32_t SURROGATE_LAST = 0xDFFF;
+
+// 解码 pos 处的一个 UTF-8 字符，返回其字节数；非法、截断、超长编码、代理区码点及超出 U+10FFFF 的码点返回 0
+constexpr size_t DecodeUtf8(std::string_view text, size_t pos, uint32_t& codePoint)
+{
+    auto lead = static_cast<uint8_t>(text[pos]);
+    size_t length = 0;
+    uint32_t minCodePoint = 0;
+    if (lead < 0x80) {
+        codePoint = lead;
+        return 1;
+    } else if ((lead & 0xE0) == 0xC0) {
+        length = 2;
+        codePoint = lead & 0x1F;
+        minCodePoint = 0x80;
+    } else if ((lead & 0xF0) == 0xE0) {
+        length = 3;
+        codePoint = lead & 0x0F;
+        minCodePoint = 0x800;
+    } else if ((lead & 0xF8) == 0xF0) {
+        length = 4;
+        codePoint = lead & 0x07;
+        minCodePoint = 0x10000;
+    } else {
+        return 0;
+    }
+    if (length > text.size() - pos) {
+        return 0;
+    }
+    for (size_t i = 1; i < length; ++i) {
+        auto next = static_cast<uint8_t>(text[pos + i]);
+        if ((next & 0xC0) != 0x80) {
+            return 0;
+        }
+        codePoint = (codePoint << 6) | (next & 0x3F);
+    }
+    if (codePoint < minCodePoint || codePoint > MAX_UNICODE_CODE_POINT ||
+        (codePoint >= SURROGATE_FIRST && codePoint <= SURROGATE_LAST)) {
+        return 0;
+    }
+    return length;
+}
+
+// 文本为空或全部由空白/不可见字符组成时返回 true，遇到第一个可见字符或非法编码立即返回 false
+constexpr bool IsAllInvisibleText(std::string_view text)
+{
+    size_t pos = 0;
+    while (pos < text.size()) {
+        auto byte = static_cast<uint8_t>(text[pos]);
+        if (byte < 0x80) {
+            if (byte >= 0x40 || ((ASCII_WHITESPACE_MASK >> byte) & 1) == 0) {
+                return false;
+            }
+            ++pos;
+            continue;
+        }
+        uint32_t codePoint = 0;
+        size_t length = DecodeUtf8(text, pos, codePoint);
+        if (length == 0 || !IsInvisibleCodePoint(codePoint)) {
+            return false;
+        }
+        pos += length;
+    }
+    return true;
+}
+} // namespace OHOS::SelectionFwk
+
+#endif // SELECTION_WHITESPACE_H
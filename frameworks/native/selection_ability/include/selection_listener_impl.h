@@ -27,8 +27,11 @@ public:
     ~SelectionListenerImpl() override = default;
     ErrCode OnSelectionChange(const SelectionInfoData& SelectionInfoData) override;
     ErrCode FocusChange(const SelectionFocusChangeInfo& focusChangeInfo) override;
+    ErrCode OnSelectionEvents(const SelectionEventBatch& eventBatch) override;
 
 private:
+    ErrCode HandleFocusChange(int32_t windowId, int32_t pid, bool isFocused);
+
     std::shared_ptr<SelectionInterface> selectionI_;
 };
 }
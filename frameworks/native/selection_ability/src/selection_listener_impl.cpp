@@ -43,16 +43,47 @@ ErrCode SelectionListenerImpl::OnSelectionChange(const SelectionInfoData& select
 ErrCode SelectionListenerImpl::FocusChange(const SelectionFocusChangeInfo& focusChangeInfo)
 {
     SELECTION_HILOGW("Recveive FocusChange: %{public}s.", focusChangeInfo.ToString().c_str());
-    if (!focusChangeInfo.isFocused_) {
+    return HandleFocusChange(focusChangeInfo.windowId_, focusChangeInfo.pid_, focusChangeInfo.isFocused_);
+}
+
+ErrCode SelectionListenerImpl::OnSelectionEvents(const SelectionEventBatch& eventBatch)
+{
+    SELECTION_HILOGI("Receive %{public}zu selection events.", eventBatch.events.size());
+    // 按服务端产生的顺序逐个分发，事件直接引用批量数据，不再拷贝
+    for (const auto& event : eventBatch.events) {
+        switch (event.type) {
+            case SelectionEventType::SELECTION:
+                if (selectionI_ == nullptr) {
+                    SELECTION_HILOGI("selectionI_ is nullptr");
+                    break;
+                }
+                selectionI_->OnSelectionEvent(event.selectionInfo);
+                break;
+            case SelectionEventType::FOCUS_CHANGE:
+                HandleFocusChange(event.windowId, event.pid, event.isFocused);
+                break;
+            case SelectionEventType::PANEL_STATE:
+                SELECTION_HILOGD("Panel state of window %{public}d: %{public}d.", event.windowId, event.isFocused);
+                break;
+            default:
+                break;
+        }
+    }
+    return NO_ERROR;
+}
+
+ErrCode SelectionListenerImpl::HandleFocusChange(int32_t windowId, int32_t pid, bool isFocused)
+{
+    if (!isFocused) {
         return NO_ERROR;
     }
     auto selectionAppPid = getpid();
-    if (selectionAppPid == focusChangeInfo.pid_) {
+    if (selectionAppPid == pid) {
         SELECTION_HILOGI("No need to hide or destory selection panel because window of selection app is focused.");
         return NO_ERROR;
     }
 
-    SelectionAbility::GetInstance()->Dispose(focusChangeInfo.windowId_);
+    SelectionAbility::GetInstance()->Dispose(windowId);
     return NO_ERROR;
 }
 } // namespace SelectionFramework
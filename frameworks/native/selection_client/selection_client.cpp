@@ -15,38 +15,49 @@
 
 #include "selection_client.h"
 
+#include <unistd.h>
 #include "iselection_service.h"
 #include "iservice_registry.h"
+#include "selection_content_shm.h"
 #include "selection_log.h"
 #include "system_ability_definition.h"
 
 using namespace OHOS;
 using namespace OHOS::SelectionFwk;
 
-SelectionClient& SelectionClient::GetInstance()
+namespace {
+sptr<ISelectionService> GetSelectionService()
 {
-    static SelectionClient instance;
-    return instance;
-}
-
-bool SelectionClient::IsCurrentSelectionApp(int pid)
-{
-    SELECTION_HILOGI("SelectionClient::IsCurrentSelectionApp");
-    bool result = false;
     auto systemAbilityManager = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
     if (systemAbilityManager == nullptr) {
         SELECTION_HILOGE("system ability manager is nullptr!");
-        return result;
+        return nullptr;
     }
-    sptr<IRemoteObject> systemAbility = nullptr;
-    systemAbility = systemAbilityManager->GetSystemAbility(SELECTION_FWK_SA_ID);
+    sptr<IRemoteObject> systemAbility = systemAbilityManager->GetSystemAbility(SELECTION_FWK_SA_ID);
     if (systemAbility == nullptr) {
         SELECTION_HILOGE("get system ability is nullptr!");
-        return result;
+        return nullptr;
     }
     auto abilityManager = iface_cast<ISelectionService>(systemAbility);
     if (abilityManager == nullptr) {
         SELECTION_HILOGE("abilityManager is nullptr!");
+    }
+    return abilityManager;
+}
+} // namespace
+
+SelectionClient& SelectionClient::GetInstance()
+{
+    static SelectionClient instance;
+    return instance;
+}
+
+bool SelectionClient::IsCurrentSelectionApp(int pid)
+{
+    SELECTION_HILOGI("SelectionClient::IsCurrentSelectionApp");
+    bool result = false;
+    auto abilityManager = GetSelectionService();
+    if (abilityManager == nullptr) {
         return result;
     }
     ErrCode errCode = abilityManager->IsCurrentSelectionApp(pid, result);
@@ -59,25 +70,87 @@ bool SelectionClient::IsCurrentSelectionApp(int pid)
 int32_t SelectionClient::GetSelectionContent(std::string& selectionContent)
 {
     SELECTION_HILOGI("SelectionClient::GetSelectionContent");
-    auto systemAbilityManager = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
-    if (systemAbilityManager == nullptr) {
-        SELECTION_HILOGE("system ability manager is nullptr!");
+    auto abilityManager = GetSelectionService();
+    if (abilityManager == nullptr) {
         return ErrorCode::ERROR_SELECTION_SERVICE;
     }
-    sptr<IRemoteObject> systemAbility = nullptr;
-    systemAbility = systemAbilityManager->GetSystemAbility(SELECTION_FWK_SA_ID);
-    if (systemAbility == nullptr) {
-        SELECTION_HILOGE("get system ability is nullptr!");
+    auto ret = abilityManager->GetSelectionContent(selectionContent);
+    if (ret != ErrorCode::NO_ERROR) {
+        SELECTION_HILOGE("SelectionClient::GetSelectionContent GetSelectionContent failed, ret = %{public}d", ret);
+    }
+    return ret;
+}
+
+int32_t SelectionClient::GetSelectionContentByShm(std::string& selectionContent)
+{
+    SELECTION_HILOGI("SelectionClient::GetSelectionContentByShm");
+    return VisitSelectionContentByShm([&selectionContent](std::string_view content) {
+        selectionContent.assign(content);
+    });
+}
+
+int32_t SelectionClient::VisitSelectionContentByShm(const std::function<void(std::string_view content)>& visitor)
+{
+    if (!visitor) {
+        SELECTION_HILOGE("SelectionClient::VisitSelectionContentByShm visitor is null");
         return ErrorCode::ERROR_SELECTION_SERVICE;
     }
-    auto abilityManager = iface_cast<ISelectionService>(systemAbility);
+    auto abilityManager = GetSelectionService();
     if (abilityManager == nullptr) {
-        SELECTION_HILOGE("abilityManager is nullptr!");
         return ErrorCode::ERROR_SELECTION_SERVICE;
     }
-    auto ret = abilityManager->GetSelectionContent(selectionContent);
+    int contentFd = -1;
+    auto ret = abilityManager->GetSelectionContentFd(contentFd);
     if (ret != ErrorCode::NO_ERROR) {
-        SELECTION_HILOGE("SelectionClient::GetSelectionContent GetSelectionContent failed, ret = %{public}d", ret);
+        SELECTION_HILOGE("SelectionClient::GetSelectionContentByShm failed, ret = %{public}d", ret);
+        if (contentFd >= 0) {
+            close(contentFd);
+        }
+        return ret;
+    }
+    bool readResult = VisitSelectionContentShm(contentFd, visitor);
+    if (contentFd >= 0) {
+        close(contentFd);
+    }
+    if (!readResult) {
+        SELECTION_HILOGE("Read selection content from shared memory failed");
+        return ErrorCode::ERROR_SELECTION_SERVICE;
+    }
+    return ErrorCode::NO_ERROR;
+}
+
+int32_t SelectionClient::OpenSelectionContent(uint32_t& contentLength)
+{
+    SELECTION_HILOGI("SelectionClient::OpenSelectionContent");
+    auto abilityManager = GetSelectionService();
+    if (abilityManager == nullptr) {
+        return ErrorCode::ERROR_SELECTION_SERVICE;
+    }
+    auto ret = abilityManager->OpenSelectionContent(contentLength);
+    if (ret != ErrorCode::NO_ERROR) {
+        SELECTION_HILOGE("SelectionClient::OpenSelectionContent failed, ret = %{public}d", ret);
+    }
+    return ret;
+}
+
+int32_t SelectionClient::ReadSelectionContentChunk(uint32_t offset, uint32_t maxLength, std::string& chunk)
+{
+    auto abilityManager = GetSelectionService();
+    if (abilityManager == nullptr) {
+        return ErrorCode::ERROR_SELECTION_SERVICE;
+    }
+    auto ret = abilityManager->ReadSelectionContentChunk(offset, maxLength, chunk);
+    if (ret != ErrorCode::NO_ERROR) {
+        SELECTION_HILOGE("SelectionClient::ReadSelectionContentChunk failed, ret = %{public}d", ret);
     }
     return ret;
 }
+
+int32_t SelectionClient::CloseSelectionContent()
+{
+    auto abilityManager = GetSelectionService();
+    if (abilityManager == nullptr) {
+        return ErrorCode::ERROR_SELECTION_SERVICE;
+    }
+    return abilityManager->CloseSelectionContent();
+}
@@ -17,7 +17,9 @@
 #define SELECTION_CLIENT_H
 
 #include <cstdint>
+#include <functional>
 #include <string>
+#include <string_view>
 #include "visibility.h"
 
 class SelectionClient {
@@ -25,6 +27,14 @@ public:
     SELECTION_API static SelectionClient& GetInstance();
     bool IsCurrentSelectionApp(int pid);
     int32_t GetSelectionContent(std::string& selectionContent);
+    // 通过只读共享内存获取选中内容，适用于超出普通接口长度上限的大段文本；内容会复制到 selectionContent
+    int32_t GetSelectionContentByShm(std::string& selectionContent);
+    // 零拷贝方式：直接以指向只读映射区的视图回调选中内容，视图仅在回调期间有效
+    int32_t VisitSelectionContentByShm(const std::function<void(std::string_view content)>& visitor);
+    // 分块读取选中内容：先打开获取总长度（字节），再按偏移读取，每块都在 UTF-8 字符边界结束
+    int32_t OpenSelectionContent(uint32_t& contentLength);
+    int32_t ReadSelectionContentChunk(uint32_t offset, uint32_t maxLength, std::string& chunk);
+    int32_t CloseSelectionContent();
 };
 
 #endif // SELECTION_CLIENT_H
\ No newline at end of file
@@ -17,6 +17,7 @@
 #define SELECTION_FOCUS_MONITOR_MANAGER_H
 
 #include <functional>
+#include <mutex>
 #include "focus_change_info.h"
 #ifdef SCENE_BOARD_ENABLE
 #include "window_manager_lite.h"
@@ -27,16 +28,35 @@
 namespace OHOS {
 namespace SelectionFwk {
 using FocusHandle = std::function<void(const sptr<Rosen::FocusChangeInfo> &focusChangeInfo, bool)>;
+
+constexpr int32_t INVALID_FOCUS_WINDOW_ID = -1;
+
+struct FocusWindowInfo {
+    int32_t windowId = INVALID_FOCUS_WINDOW_ID;
+    uint64_t displayId = 0;
+    int32_t pid = -1;
+    int32_t uid = -1;
+    uint32_t windowType = 0;
+};
+
 class FocusMonitorManager {
 public:
     static FocusMonitorManager &GetInstance();
     void RegisterFocusChangedListener(const FocusHandle &handle);
     void UnregisterFocusChangedListener();
 
+    // 优先返回焦点回调维护的缓存，缓存无效时才向窗口管理查询一次
+    bool GetFocusWindowInfo(FocusWindowInfo &info);
+    void UpdateFocusCache(const sptr<Rosen::FocusChangeInfo> &focusChangeInfo, bool isFocused);
+    void InvalidateFocusCache();
+
 private:
     FocusMonitorManager() = default;
 private:
+    std::mutex focusCacheMutex_; // 保护 focusListener_ 与焦点缓存
     sptr<OHOS::Rosen::IFocusChangedListener> focusListener_ = nullptr;
+    FocusWindowInfo focusCache_;
+    bool isFocusCacheValid_ = false;
 };
 } // namespace SelectionFwk
 } // namespace OHOS
@@ -27,37 +27,112 @@ FocusMonitorManager &FocusMonitorManager::GetInstance()
 
 void FocusMonitorManager::RegisterFocusChangedListener(const FocusHandle &handle)
 {
-    if (focusListener_ != nullptr) {
-        SELECTION_HILOGE("focusListener_ has been registered by others.");
-        return;
+    auto cachedHandle = [this, handle](const sptr<FocusChangeInfo> &focusChangeInfo, bool isFocused) {
+        UpdateFocusCache(focusChangeInfo, isFocused);
+        if (handle != nullptr) {
+            handle(focusChangeInfo, isFocused);
+        }
+    };
+    sptr<IFocusChangedListener> listener;
+    {
+        std::lock_guard<std::mutex> lock(focusCacheMutex_);
+        if (focusListener_ != nullptr) {
+            SELECTION_HILOGE("focusListener_ has been registered by others.");
+            return;
+        }
+        focusListener_ = sptr<FocusChangedListener>::MakeSptr(cachedHandle);
+        listener = focusListener_;
     }
-
-    focusListener_ = sptr<FocusChangedListener>::MakeSptr(handle);
-    if (focusListener_ == nullptr) {
+    if (listener == nullptr) {
         SELECTION_HILOGE("failed to create focusListener_");
         return;
     }
+    // 注册过程中回调可能同步到达并获取 focusCacheMutex_，因此在锁外注册
 #ifdef SCENE_BOARD_ENABLE
-    WMError ret = WindowManagerLite::GetInstance().RegisterFocusChangedListener(focusListener_);
+    WMError ret = WindowManagerLite::GetInstance().RegisterFocusChangedListener(listener);
 #else
-    WMError ret = WindowManager::GetInstance().RegisterFocusChangedListener(focusListener_);
+    WMError ret = WindowManager::GetInstance().RegisterFocusChangedListener(listener);
 #endif
     SELECTION_HILOGI("register focus changed focusListener_ ret: %{public}d", ret);
 }
 
 void FocusMonitorManager::UnregisterFocusChangedListener()
 {
-    if (focusListener_ == nullptr) {
+    sptr<IFocusChangedListener> listener;
+    {
+        std::lock_guard<std::mutex> lock(focusCacheMutex_);
+        listener = focusListener_;
+        focusListener_ = nullptr;
+    }
+    if (listener == nullptr) {
         SELECTION_HILOGE("focusListener_ is nullptr");
         return;
     }
 #ifdef SCENE_BOARD_ENABLE
-    WMError ret = WindowManagerLite::GetInstance().UnregisterFocusChangedListener(focusListener_);
+    WMError ret = WindowManagerLite::GetInstance().UnregisterFocusChangedListener(listener);
 #else
-    WMError ret = WindowManager::GetInstance().UnregisterFocusChangedListener(focusListener_);
+    WMError ret = WindowManager::GetInstance().UnregisterFocusChangedListener(listener);
 #endif
     SELECTION_HILOGI("Unregister focus changed focusListener_ ret: %{public}d", ret);
-    focusListener_ = nullptr;
+    InvalidateFocusCache();
+}
+
+bool FocusMonitorManager::GetFocusWindowInfo(FocusWindowInfo &info)
+{
+    {
+        std::lock_guard<std::mutex> lock(focusCacheMutex_);
+        if (isFocusCacheValid_) {
+            info = focusCache_;
+            return true;
+        }
+    }
+    FocusChangeInfo focusInfo;
+#ifdef SCENE_BOARD_ENABLE
+    WindowManagerLite::GetInstance().GetFocusWindowInfo(focusInfo);
+#else
+    WindowManager::GetInstance().GetFocusWindowInfo(focusInfo);
+#endif
+    info.windowId = focusInfo.windowId_;
+    info.displayId = focusInfo.displayId_;
+    info.pid = focusInfo.pid_;
+    info.uid = focusInfo.uid_;
+    info.windowType = static_cast<uint32_t>(focusInfo.windowType_);
+    SELECTION_HILOGD("focus cache miss, windowId: %{public}d", info.windowId);
+
+    std::lock_guard<std::mutex> lock(focusCacheMutex_);
+    // 查询期间若回调已刷新缓存，以回调结果为准
+    if (!isFocusCacheValid_ && focusListener_ != nullptr) {
+        focusCache_ = info;
+        isFocusCacheValid_ = true;
+    }
+    return info.windowId != INVALID_FOCUS_WINDOW_ID;
+}
+
+void FocusMonitorManager::UpdateFocusCache(const sptr<FocusChangeInfo> &focusChangeInfo, bool isFocused)
+{
+    if (focusChangeInfo == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(focusCacheMutex_);
+    if (!isFocused) {
+        // 失焦通知先于获焦通知到达，仅当失焦的正是缓存窗口时才失效
+        if (isFocusCacheValid_ && focusCache_.windowId == focusChangeInfo->windowId_) {
+            isFocusCacheValid_ = false;
+        }
+        return;
+    }
+    focusCache_.windowId = focusChangeInfo->windowId_;
+    focusCache_.displayId = focusChangeInfo->displayId_;
+    focusCache_.pid = focusChangeInfo->pid_;
+    focusCache_.uid = focusChangeInfo->uid_;
+    focusCache_.windowType = static_cast<uint32_t>(focusChangeInfo->windowType_);
+    isFocusCacheValid_ = true;
+}
+
+void FocusMonitorManager::InvalidateFocusCache()
+{
+    std::lock_guard<std::mutex> lock(focusCacheMutex_);
+    isFocusCacheValid_ = false;
 }
 } // namespace SelectionFwk
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SELECTION_CONTENT_SESSION_H
+#define SELECTION_CONTENT_SESSION_H
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include "ashmem.h"
+
+namespace OHOS::SelectionFwk {
+constexpr const uint32_t MAX_SELECTION_CONTENT_CHUNK_SIZE = 64 * 1024; // 单次分块读取的长度上限（字节）
+
+// 分块读取会话：持有只读共享内存中的选中内容，扩展按偏移逐块读取，
+// 每块的结束位置都落在 UTF-8 字符边界上
+class SelectionContentSession {
+public:
+    ~SelectionContentSession();
+
+    // 接管 fd 的所有权，成功时返回内容总长度（字节）
+    int32_t Open(int32_t fd, int32_t pid, uint32_t& length);
+    int32_t Read(int32_t pid, uint32_t offset, uint32_t maxLength, std::string& chunk);
+    // pid 为 -1 时无条件关闭
+    void Close(int32_t pid);
+    bool IsOpen() const;
+
+    // 返回不超过 maxLength 且不截断 UTF-8 字符的块长度
+    static uint32_t Utf8ChunkLength(const char *data, uint32_t remaining, uint32_t maxLength);
+
+private:
+    void Reset();
+
+    mutable std::mutex mutex_;
+    sptr<Ashmem> ashmem_;
+    const char *content_ = nullptr;
+    uint32_t length_ = 0;
+    int32_t pid_ = -1;
+};
+} // namespace OHOS::SelectionFwk
+
+#endif // SELECTION_CONTENT_SESSION_H
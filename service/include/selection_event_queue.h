@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SELECTION_EVENT_QUEUE_H
+#define SELECTION_EVENT_QUEUE_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include "selection_interface.h"
+
+namespace OHOS::SelectionFwk {
+constexpr const size_t SPSC_CACHE_LINE_SIZE = 64;
+
+enum class SelectionRecordKind : uint32_t {
+    SELECTION_DONE = 0, // 划词完成，通知监听者
+    SELECTION_START,    // 划词开始，预热扩展连接
+};
+
+// MMI 回调线程投递给划词工作线程的定长事件，避免在入队时分配内存；
+// 只携带窗口ID，包名由工作线程按窗口ID查询并等待
+struct SelectionEventRecord {
+    SelectionRecordKind kind = SelectionRecordKind::SELECTION_DONE;
+    uint32_t seqId = 0;
+    int64_t enqueueTimeUs = 0;
+    SelectionType selectionType = SelectionType::MOVE_SELECTION;
+    int32_t startDisplayX = 0;
+    int32_t startDisplayY = 0;
+    int32_t endDisplayX = 0;
+    int32_t endDisplayY = 0;
+    int32_t startWindowX = 0;
+    int32_t startWindowY = 0;
+    int32_t endWindowX = 0;
+    int32_t endWindowY = 0;
+    uint32_t displayId = 0;
+    uint32_t windowId = 0;
+
+    void FromSelectionInfo(const SelectionInfo& info)
+    {
+        selectionType = info.selectionType;
+        startDisplayX = info.startDisplayX;
+        startDisplayY = info.startDisplayY;
+        endDisplayX = info.endDisplayX;
+        endDisplayY = info.endDisplayY;
+        startWindowX = info.startWindowX;
+        startWindowY = info.startWindowY;
+        endWindowX = info.endWindowX;
+        endWindowY = info.endWindowY;
+        displayId = info.displayId;
+        windowId = info.windowId;
+    }
+
+    SelectionInfo ToSelectionInfo() const
+    {
+        SelectionInfo info;
+        info.selectionType = selectionType;
+        info.startDisplayX = startDisplayX;
+        info.startDisplayY = startDisplayY;
+        info.endDisplayX = endDisplayX;
+        info.endDisplayY = endDisplayY;
+        info.startWindowX = startWindowX;
+        info.startWindowY = startWindowY;
+        info.endWindowX = endWindowX;
+        info.endWindowY = endWindowY;
+        info.displayId = displayId;
+        info.windowId = windowId;
+        return info;
+    }
+};
+
+static_assert(std::is_trivially_copyable_v<SelectionEventRecord>, "selection event record must stay POD");
+
+// 单生产者单消费者无锁环形队列，CAPACITY 必须为 2 的幂
+template <typename T, size_t CAPACITY>
+class SpscRingBuffer {
+    static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "capacity must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>, "element must be trivially copyable");
+
+public:
+    bool TryPush(const T& item)
+    {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) >= CAPACITY) {
+            return false;
+        }
+        buffer_[tail & (CAPACITY - 1)] = item;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPop(T& item)
+    {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = buffer_[head & (CAPACITY - 1)];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t Size() const
+    {
+        // 先读 head 再读 tail，保证结果不会因并发出队而下溢
+        size_t head = head_.load(std::memory_order_acquire);
+        return tail_.load(std::memory_order_acquire) - head;
+    }
+
+    bool Empty() const
+    {
+        return Size() == 0;
+    }
+
+private:
+    alignas(SPSC_CACHE_LINE_SIZE) std::atomic<size_t> head_ = 0;
+    alignas(SPSC_CACHE_LINE_SIZE) std::atomic<size_t> tail_ = 0;
+    alignas(SPSC_CACHE_LINE_SIZE) std::array<T, CAPACITY> buffer_ {};
+};
+
+// 多生产者单消费者有界无锁队列，CAPACITY 必须为 2 的幂；
+// 每个槽位带序号，生产者以 CAS 抢占写入位置，消费者按序号判断槽位是否已写完
+template <typename T, size_t CAPACITY>
+class MpscRingBuffer {
+    static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "capacity must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>, "element must be trivially copyable");
+
+public:
+    MpscRingBuffer()
+    {
+        for (size_t i = 0; i < CAPACITY; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool TryPush(const T& item)
+    {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = slots_[pos & (CAPACITY - 1)];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.item = item;
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                // 槽位尚未被消费者释放，队列已满
+                return false;
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // 仅允许单个消费者调用
+    bool TryPop(T& item)
+    {
+        size_t head = head_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[head & (CAPACITY - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != head + 1) {
+            return false;
+        }
+        item = slot.item;
+        slot.sequence.store(head + CAPACITY, std::memory_order_release);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 包含已抢占位置但尚未写完的元素
+    size_t Size() const
+    {
+        size_t head = head_.load(std::memory_order_acquire);
+        return tail_.load(std::memory_order_acquire) - head;
+    }
+
+    // 只在队首元素已写完时返回 false，消费者据此等待不会空转
+    bool Empty() const
+    {
+        size_t head = head_.load(std::memory_order_acquire);
+        return slots_[head & (CAPACITY - 1)].sequence.load(std::memory_order_acquire) != head + 1;
+    }
+
+private:
+    struct Slot {
+        std::atomic<size_t> sequence = 0;
+        T item {};
+    };
+
+    alignas(SPSC_CACHE_LINE_SIZE) std::atomic<size_t> head_ = 0;
+    alignas(SPSC_CACHE_LINE_SIZE) std::atomic<size_t> tail_ = 0;
+    alignas(SPSC_CACHE_LINE_SIZE) std::array<Slot, CAPACITY> slots_ {};
+};
+} // namespace OHOS::SelectionFwk
+
+#endif // SELECTION_EVENT_QUEUE_H
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SELECTION_EVENT_WORKER_H
+#define SELECTION_EVENT_WORKER_H
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include "selection_event_queue.h"
+
+namespace OHOS::SelectionFwk {
+constexpr const size_t SELECTION_EVENT_QUEUE_CAPACITY = 64; // 划词事件队列容量
+
+enum class SelectionStage : uint32_t {
+    QUEUE_WAIT = 0, // 入队到出队
+    CONNECT,        // 拉起扩展与重置卸载定时器
+    NOTIFY,         // 通知监听者
+    STAGE_COUNT,
+};
+
+struct SelectionStageLatency {
+    uint64_t count = 0;
+    uint64_t totalUs = 0;
+    uint64_t maxUs = 0;
+};
+
+struct SelectionWorkerStats {
+    size_t queueDepth = 0;
+    size_t maxQueueDepth = 0;
+    uint64_t dropped = 0;
+    std::array<SelectionStageLatency, static_cast<size_t>(SelectionStage::STAGE_COUNT)> stages {};
+};
+
+class SelectionEventWorker {
+public:
+    using EventHandler = std::function<void(const SelectionEventRecord& record)>;
+
+    SelectionEventWorker() = default;
+    ~SelectionEventWorker();
+
+    void Start(const EventHandler& handler);
+    void Stop();
+    // 仅允许 MMI 回调线程调用，队列满时丢弃事件并返回 false
+    bool Post(SelectionEventRecord& record);
+    void RecordStage(SelectionStage stage, int64_t costUs);
+    SelectionWorkerStats GetStats() const;
+
+    static int64_t GetMonotonicTimeUs();
+
+private:
+    void Run();
+
+    struct StageCounter {
+        std::atomic<uint64_t> count = 0;
+        std::atomic<uint64_t> totalUs = 0;
+        std::atomic<uint64_t> maxUs = 0;
+    };
+
+    SpscRingBuffer<SelectionEventRecord, SELECTION_EVENT_QUEUE_CAPACITY> queue_;
+    EventHandler handler_ = nullptr;
+    std::thread worker_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::atomic<bool> running_ = false;
+    std::atomic<bool> waiting_ = false;
+    std::atomic<size_t> maxQueueDepth_ = 0;
+    std::atomic<uint64_t> dropped_ = 0;
+    std::array<StageCounter, static_cast<size_t>(SelectionStage::STAGE_COUNT)> stages_;
+};
+} // namespace OHOS::SelectionFwk
+
+#endif // SELECTION_EVENT_WORKER_H
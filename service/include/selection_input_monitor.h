@@ -16,13 +16,24 @@
 #ifndef SELECTION_INPUT_MONITOR_H
 #define SELECTION_INPUT_MONITOR_H
 
+#include <array>
+#include <condition_variable>
+#include <deque>
 #include <fcntl.h>
+#include <functional>
 #include <linux/input.h>
 #include <linux/uinput.h>
+#include <future>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 #include <memory>
 #include <i_input_event_consumer.h>
+#include "selection_event_worker.h"
+#include "selection_input_trace.h"
+#include "selection_input_transition.h"
 #include "selection_interface.h"
 
 namespace OHOS::SelectionFwk {
@@ -33,26 +44,74 @@ constexpr const uint32_t TRIPLE_CLICK_TIME = 300;          // 三击识别时间
 constexpr const uint32_t MAX_PASTERBOARD_TEXT_LENGTH = 2000; // 剪贴板文本最大长度
 constexpr const uint32_t BYTES_PER_CHINESE_CHAR = 3;       // UTF-8中中文字符占用字节数
 constexpr const uint32_t MAX_POSITION_CHANGE_OFFSET = 10;  // 位置变化最大偏移量（像素）
+constexpr const int64_t TOUCH_LONG_PRESS_TIME = 500;       // 触摸长按识别时间（毫秒）
+constexpr const int32_t TOUCH_SLOP = 16;                   // 触摸移动判定阈值（像素）
 constexpr const uint32_t DISCONNECT_TIMER_RETRY_MS = 5000; // 断开连接重试间隔（毫秒）
 constexpr const uint32_t DEFAULT_UNLOAD_TIMEOUT_MS = 300000; // 默认卸载超时（5分钟）
+constexpr const uint32_t MAX_BUNDLE_NAME_CACHE_SIZE = 16;  // 窗口包名缓存最大条目数
+constexpr const uint32_t WINDOW_INFO_WAIT_TIMEOUT_MS = 500; // 等待窗口信息查询结果超时（毫秒）
+constexpr const size_t MAX_PENDING_BUNDLE_NAME_QUERIES = 4; // 待查询窗口数上限，超出时丢弃最早的请求
+constexpr const int64_t USEC_PER_MSEC = 1000;
+constexpr const int64_t INVALID_CLICK_TIME = -1;
+constexpr const size_t MAX_SELECTION_POINTER_SLOTS = 4;    // 同时独立跟踪的（设备，屏幕）组合数
+constexpr const int32_t INVALID_POINTER_SLOT_ID = -1;
+constexpr const int32_t INVALID_QUERY_WINDOW_ID = -1;
+
+class WindowBundleNameCache {
+public:
+    bool Get(int32_t windowId, std::string& bundleName);
+    void Put(int32_t windowId, const std::string& bundleName);
+    void Erase(int32_t windowId);
+
+private:
+    std::mutex mutex_;
+    std::unordered_map<int32_t, std::string> bundleNames_;
+};
+
+// 常驻的窗口包名查询线程：输入线程只投递窗口ID，由划词工作线程等待查询结果
+class WindowBundleNameResolver {
+public:
+    using QueryFunc = std::function<std::string(int32_t windowId)>;
 
-enum class SelectInputState : uint32_t {
-    SELECT_INPUT_INITIAL = 0,
-    SELECT_INPUT_WORD_BEGIN,
-    SELECT_INPUT_WAIT_LEFT_MOVE,
-    SELECT_INPUT_WAIT_DOUBLE_CLICK,
-    SELECT_INPUT_WAIT_TRIPLE_CLICK,
-    SELECT_INPUT_WORD_END,
-    SELECT_INPUT_DONE,
+    WindowBundleNameResolver(std::shared_ptr<WindowBundleNameCache> cache, const QueryFunc& query);
+    ~WindowBundleNameResolver();
+
+    void Request(int32_t windowId);
+    bool Wait(int32_t windowId, std::string& bundleName, uint32_t timeoutMs);
+
+private:
+    void Run();
+    bool IsQueryingLocked(int32_t windowId) const;
+
+    std::shared_ptr<WindowBundleNameCache> cache_;
+    QueryFunc query_;
+    std::mutex mutex_;
+    std::condition_variable requestCv_;
+    std::condition_variable resultCv_;
+    std::deque<int32_t> pending_;
+    int32_t inFlightWindowId_ = INVALID_QUERY_WINDOW_ID;  // 正在查询的窗口ID
+    bool stopping_ = false;
+    std::thread worker_;
 };
 
-enum class SelectInputSubState : uint32_t {
-    SUB_INITIAL = 0,
-    SUB_WAIT_POINTER_ACTION_BUTTON_DOWN,
-    SUB_WAIT_POINTER_ACTION_BUTTON_UP,
-    SUB_WAIT_KEY_CTRL_DOWN,
-    SUB_WAIT_KEY_CTRL_UP,
-    SUB_WAIT_BUTTON_OR_CTRL_DOWN,
+// 每个（设备，屏幕）组合单独维护一份划词状态，多鼠标、多屏幕的事件交错时互不复位
+struct SelectionPointerSlot {
+    int32_t deviceId = INVALID_POINTER_SLOT_ID;
+    int32_t displayId = INVALID_POINTER_SLOT_ID;
+    uint64_t lastUsedSeq = 0;
+    SelectInputState curSelectState = SelectInputState::SELECT_INPUT_INITIAL;
+    SelectInputSubState subSelectState = SelectInputSubState::SUB_INITIAL;
+    int64_t lastClickTime = INVALID_CLICK_TIME;
+    SelectTouchState touchState = SelectTouchState::TOUCH_IDLE;
+    int64_t touchDownTime = 0;
+    SelectionInfo selectionInfo;
+
+    bool Matches(int32_t device, int32_t display) const
+    {
+        return deviceId == device && displayId == display;
+    }
+    bool IsButtonHeld() const;
+    void Reset(int32_t device, int32_t display);
 };
 
 class BaseSelectionInputMonitor : public IInputEventConsumer {
@@ -67,37 +126,54 @@ public:
     virtual bool IsSelectionTriggered() const;
     virtual const SelectionInfo& GetSelectionInfo() const;
     virtual bool IsInputWordEnd() const;
+    bool IsHoverInert() const;
+    bool IsHoverInert(int32_t deviceId, int32_t displayId) const;
+    SelectInputState GetSelectState() const;
+    // 回放模式下只按事件时间戳计时，且不查询窗口信息，用于确定性测试与基准
+    void SetReplayMode(bool enable);
+    void InvalidateWindowBundleName(int32_t windowId) const;
+    // 按窗口ID取包名：命中缓存直接返回，否则等待查询线程的结果，只在划词工作线程调用
+    bool WaitBundleName(int32_t windowId, std::string& bundleName) const;
 
 private:
-    void ProcessInputEvent(std::shared_ptr<KeyEvent> keyEvent) const;
-    void ProcessInputEvent(std::shared_ptr<PointerEvent> pointerEvent) const;
-
-    void InputInitialProcess(std::shared_ptr<PointerEvent> pointerEvent) const;
-    void InputWordBeginProcess(std::shared_ptr<PointerEvent> pointerEvent) const;
-    void ProcessWordSelection(std::shared_ptr<PointerEvent> pointerEvent) const;
-    void InputWordLeftMoveProcess(std::shared_ptr<PointerEvent> pointerEvent) const;
-    void InputWordDoubleClickProcess(std::shared_ptr<PointerEvent> pointerEvent) const;
-    void InputWordEndProcess(std::shared_ptr<PointerEvent> pointerEvent) const;
-    void InputDoneProcess(std::shared_ptr<PointerEvent> pointerEvent) const;
-    void InputWordTripleClickProcess(std::shared_ptr<PointerEvent> pointerEvent) const;
+    void ProcessInputEvent(const std::shared_ptr<KeyEvent>& keyEvent) const;
+    void ProcessInputEvent(const std::shared_ptr<PointerEvent>& pointerEvent) const;
+
+    SelectInputEvent ClassifyKeyEvent(const std::shared_ptr<KeyEvent>& keyEvent) const;
+    SelectInputEvent ClassifyPointerEvent(const std::shared_ptr<PointerEvent>& pointerEvent, int64_t eventTime) const;
+    SelectInputEvent ClassifyLeftButtonDown(int64_t eventTime) const;
+    bool Transit(SelectInputEvent event, const std::shared_ptr<PointerEvent>& pointerEvent, int64_t eventTime) const;
+    bool ProcessTouchEvent(const std::shared_ptr<PointerEvent>& pointerEvent, int64_t eventTime) const;
+    SelectTouchEvent ClassifyTouchEvent(const std::shared_ptr<PointerEvent>& pointerEvent) const;
+    bool TransitTouch(SelectTouchEvent event, const std::shared_ptr<PointerEvent>& pointerEvent,
+        int64_t eventTime) const;
+    bool IsTouchSlopExceeded(const std::shared_ptr<PointerEvent>& pointerEvent) const;
+    int64_t GetEventTimeMillis(const std::shared_ptr<PointerEvent>& pointerEvent) const;
     void FinishedWordSelection() const;
-    void ResetProcess(std::shared_ptr<PointerEvent> pointerEvent) const;
-    void ResetState() const;
-    void JudgeTripleClick(std::shared_ptr<PointerEvent> pointerEvent) const;
-    void SaveSelectionStartInfo(std::shared_ptr<PointerEvent> pointerEvent) const;
-    void SaveSelectionEndInfo(std::shared_ptr<PointerEvent> pointerEvent) const;
+    void SaveSelectionStartInfo(const std::shared_ptr<PointerEvent>& pointerEvent) const;
+    void SaveSelectionEndInfo(const std::shared_ptr<PointerEvent>& pointerEvent) const;
     void SaveSelectionType() const;
     bool IsSelectionDone() const;
     bool GetCtrlSelectFlag() const;
-    bool IsClickTimeout(uint32_t time) const;
-    bool ProcessMovement(std::shared_ptr<PointerEvent> pointerEvent) const;
-    bool IsTinyMovement(std::shared_ptr<PointerEvent> pointerEvent) const;
+    bool IsTinyMovement(const std::shared_ptr<PointerEvent>& pointerEvent) const;
+    void ResolveBundleNameAsync(int32_t windowId) const;
+    static std::string QueryBundleName(int32_t windowId);
+    SelectionPointerSlot& ActiveSlot() const
+    {
+        return slots_[activeSlot_];
+    }
+    size_t FindSlot(int32_t deviceId, int32_t displayId) const;
+    void SelectSlot(const std::shared_ptr<PointerEvent>& pointerEvent) const;
 
 private:
-    mutable SelectInputState curSelectState = SelectInputState::SELECT_INPUT_INITIAL;
-    mutable SelectInputSubState subSelectState = SelectInputSubState::SUB_INITIAL;
-    mutable int64_t lastClickTime = 0;
-    mutable SelectionInfo selectionInfo_;
+    // 槽位数很小，线性查找即可，每个事件的开销固定
+    mutable std::array<SelectionPointerSlot, MAX_SELECTION_POINTER_SLOTS> slots_;
+    mutable size_t activeSlot_ = 0;
+    mutable uint64_t slotUseSeq_ = 0;
+    bool replayMode_ = false;
+    std::shared_ptr<WindowBundleNameCache> bundleNameCache_ = std::make_shared<WindowBundleNameCache>();
+    std::shared_ptr<WindowBundleNameResolver> bundleNameResolver_ =
+        std::make_shared<WindowBundleNameResolver>(bundleNameCache_, QueryBundleName);
 };
 
 class SelectionInputMonitor : public IInputEventConsumer {
@@ -110,23 +186,44 @@ public:
     virtual void OnInputEvent(std::shared_ptr<AxisEvent> axisEvent) const;
 
     int32_t GetSelectionContent(std::string& selectionContent);
+    int32_t GetSelectionContentFd(int32_t& contentFd);
     bool CanGetSelectionContent() const;
 
     bool GetCanGetSelectionContentFlag() const;
     void SetCanGetSelectionContentFlag(bool flag) const;
 
+    uint64_t GetDroppedMoveEventCount() const;
+    uint64_t GetProcessedPointerEventCount() const;
+    void HandleFocusChanged(int32_t windowId) const;
+    SelectionWorkerStats GetWorkerStats() const;
+    SelectionInputTraceRecorder& GetTraceRecorder() const;
+
 private:
+    bool ShouldDropPointerEvent(const std::shared_ptr<PointerEvent>& pointerEvent) const;
     void FinishedWordSelection() const;
+    void ProcessSelectionEvent(const SelectionEventRecord& record) const;
+    void PrewarmOnSelectionStart(SelectInputState preState, SelectInputState curState) const;
     void HandleWindowFocused(std::shared_ptr<PointerEvent> pointerEvent) const;
     bool IsAppInBlocklist(const std::string& bundleName) const;
     void CloseTimerAndDisconnectExt() const;
     void HandleWordSelected() const;
+    void SetLastNotifiedSelection(uint32_t seqId, const SelectionInfo& selectionInfo) const;
+    uint32_t GetLastNotifiedSelection(SelectionInfo& selectionInfo) const;
     int32_t PasteBoardErrorCodeToSelectionService(int32_t pasteBoardErrCode) const;
 
 private:
     std::shared_ptr<BaseSelectionInputMonitor> baseInputMonitor_;
+    mutable SelectionEventWorker eventWorker_;
+    mutable SelectionInputTraceRecorder traceRecorder_;
 
     mutable std::atomic<bool> canGetSelectionContentFlag_ = false;
+    mutable std::atomic<uint64_t> droppedMoveEventCount_ = 0;
+    mutable std::atomic<uint64_t> processedPointerEventCount_ = 0;
+    mutable std::atomic<int32_t> lastNotifiedFocusWindowId_ = -1;
+    // 最近一次通知给监听者的划词，IPC 线程取内容时以此为准，不读取输入线程的槽位状态
+    mutable std::mutex lastNotifiedMutex_;
+    mutable uint32_t lastNotifiedSeqId_ = 0;
+    mutable SelectionInfo lastNotifiedInfo_;
 };
 }
 
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SELECTION_INPUT_TRACE_H
+#define SELECTION_INPUT_TRACE_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <key_event.h>
+#include <pointer_event.h>
+
+namespace OHOS::SelectionFwk {
+using namespace MMI;
+
+constexpr const uint32_t INPUT_TRACE_MAGIC = 0x52544953;  // "SITR"
+constexpr const uint16_t INPUT_TRACE_VERSION = 2;
+constexpr const uint32_t MAX_INPUT_TRACE_RECORDS = 1000000; // 单个轨迹文件最多记录的事件数
+constexpr const char *DEFAULT_INPUT_TRACE_PATH = "/data/service/el1/public/selectionfwk/selection_input.trace";
+// 划词状态机只区分 Ctrl 键，其余按键一律记为该值，轨迹中不保留用户实际输入的按键
+constexpr const int16_t INPUT_TRACE_KEYCODE_OTHER = static_cast<int16_t>(KeyEvent::KEYCODE_UNKNOWN);
+
+enum class InputTraceType : uint8_t {
+    POINTER = 0,
+    KEY = 1,
+};
+
+struct InputTraceHeader {
+    uint32_t magic = INPUT_TRACE_MAGIC;
+    uint16_t version = INPUT_TRACE_VERSION;
+    uint16_t recordSize = 0;
+};
+
+// 定长二进制记录，按事件到达顺序追加写入
+struct InputTraceRecord {
+    int64_t actionTime = 0;  // 事件时间戳（微秒）
+    int32_t displayX = 0;
+    int32_t displayY = 0;
+    int32_t windowId = -1;
+    int32_t displayId = -1;
+    int32_t deviceId = -1;
+    int32_t action = 0;      // PointerAction 或 KeyAction
+    int16_t code = 0;        // 指针事件为 ButtonId，键盘事件为 Ctrl 键码或 INPUT_TRACE_KEYCODE_OTHER
+    InputTraceType type = InputTraceType::POINTER;
+    uint8_t isRepeat = 0;
+    uint8_t sourceType = 0;  // 指针事件的 SourceType
+    uint8_t reserved[3] = {0};
+};
+
+static_assert(sizeof(InputTraceRecord) == 40, "input trace record layout must stay stable");
+
+class SelectionInputTraceRecorder {
+public:
+    ~SelectionInputTraceRecorder();
+
+    bool Start(const std::string& path);
+    void Stop();
+    bool IsRecording() const
+    {
+        return recording_.load(std::memory_order_relaxed);
+    }
+
+    void Record(const std::shared_ptr<PointerEvent>& pointerEvent);
+    void Record(const std::shared_ptr<KeyEvent>& keyEvent);
+    uint64_t GetRecordCount() const;
+
+    static bool Load(const std::string& path, std::vector<InputTraceRecord>& records);
+    static InputTraceRecord ToRecord(const std::shared_ptr<PointerEvent>& pointerEvent);
+    static InputTraceRecord ToRecord(const std::shared_ptr<KeyEvent>& keyEvent);
+    static std::shared_ptr<PointerEvent> ToPointerEvent(const InputTraceRecord& record);
+    static std::shared_ptr<KeyEvent> ToKeyEvent(const InputTraceRecord& record);
+
+private:
+    void Write(const InputTraceRecord& record);
+    static int16_t MaskKeyCode(int32_t keyCode);
+
+    std::atomic<bool> recording_ = false;
+    mutable std::mutex mutex_;
+    FILE *file_ = nullptr;
+    uint64_t recordCount_ = 0;
+};
+} // namespace OHOS::SelectionFwk
+
+#endif // SELECTION_INPUT_TRACE_H
@@ -0,0 +1,506 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SELECTION_INPUT_TRANSITION_H
+#define SELECTION_INPUT_TRANSITION_H
+
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+
+namespace OHOS::SelectionFwk {
+
+enum class SelectInputState : uint32_t {
+    SELECT_INPUT_INITIAL = 0,
+    SELECT_INPUT_WORD_BEGIN,
+    SELECT_INPUT_WAIT_LEFT_MOVE,
+    SELECT_INPUT_WAIT_DOUBLE_CLICK,
+    SELECT_INPUT_WAIT_TRIPLE_CLICK,
+    SELECT_INPUT_WORD_END,
+    SELECT_INPUT_DONE,
+    SELECT_INPUT_STATE_COUNT,
+};
+
+enum class SelectInputSubState : uint32_t {
+    SUB_INITIAL = 0,
+    SUB_WAIT_POINTER_ACTION_BUTTON_DOWN,
+    SUB_WAIT_POINTER_ACTION_BUTTON_UP,
+    SUB_WAIT_KEY_CTRL_DOWN,
+    SUB_WAIT_KEY_CTRL_UP,
+    SUB_WAIT_BUTTON_OR_CTRL_DOWN,
+    SUB_STATE_COUNT,
+};
+
+// 输入事件在进入状态机前被归一化为以下类别，状态机只按类别查表
+enum class SelectInputEvent : uint8_t {
+    POINTER_LEFT_DOWN_IN_TRIPLE = 0, // 左键按下，距上次点击不超过 TRIPLE_CLICK_TIME
+    POINTER_LEFT_DOWN_IN_DOUBLE,     // 左键按下，距上次点击不超过 DOUBLE_CLICK_TIME
+    POINTER_LEFT_DOWN_LATE,          // 左键按下，超过双击间隔
+    POINTER_LEFT_UP,
+    POINTER_LEFT_MOVE,
+    POINTER_LEFT_OTHER,
+    POINTER_HOVER_TINY,              // 无按键移动，且未离开起点 MAX_POSITION_CHANGE_OFFSET 范围
+    POINTER_HOVER,                   // 其余无按键移动
+    POINTER_OTHER_BUTTON,
+    POINTER_IGNORED,                 // 进入/离开窗口
+    KEY_CTRL_DOWN,
+    KEY_CTRL_DOWN_REPEAT,
+    KEY_CTRL_UP,
+    KEY_CTRL_UP_REPEAT,
+    KEY_CTRL_OTHER,
+    KEY_OTHER,
+    EVENT_COUNT,
+};
+
+enum class SelectInputAction : uint8_t {
+    ACTION_NONE = 0,
+    ACTION_BEGIN,       // 记录点击时间与起点信息
+    ACTION_STAMP_CLICK, // 仅记录点击时间
+    ACTION_SAVE_END,    // 记录终点信息与划词类型
+};
+
+// 触摸屏长按划词的识别状态，与鼠标状态机并行运行
+enum class SelectTouchState : uint8_t {
+    TOUCH_IDLE = 0,
+    TOUCH_PRESSED,      // 手指按下，等待长按
+    TOUCH_LONG_PRESSED, // 已长按，等待拖动或抬起
+    TOUCH_DRAGGING,     // 长按后拖动选择
+    TOUCH_DONE,
+    TOUCH_STATE_COUNT,
+};
+
+enum class SelectTouchEvent : uint8_t {
+    TOUCH_DOWN = 0,
+    TOUCH_MOVE_TINY,  // 移动未超出 TOUCH_SLOP 范围
+    TOUCH_MOVE,
+    TOUCH_LONG_PRESS, // 按住超过 TOUCH_LONG_PRESS_TIME，由事件时间戳推导
+    TOUCH_UP,
+    TOUCH_CANCEL,
+    TOUCH_EVENT_COUNT,
+};
+
+struct SelectInputTransition {
+    SelectInputState nextState : 8;
+    SelectInputSubState nextSubState : 8;
+    SelectInputAction action : 8;
+    bool checkFinished : 1;  // 处理完成后是否需要检查划词结束
+};
+
+namespace SelectInputRules {
+using State = SelectInputState;
+using SubState = SelectInputSubState;
+using Event = SelectInputEvent;
+using Action = SelectInputAction;
+
+constexpr SelectInputTransition Make(State state, SubState subState, Action action = Action::ACTION_NONE,
+    bool checkFinished = true)
+{
+    return SelectInputTransition { state, subState, action, checkFinished };
+}
+
+constexpr bool IsLeftDown(Event event)
+{
+    return event == Event::POINTER_LEFT_DOWN_IN_TRIPLE || event == Event::POINTER_LEFT_DOWN_IN_DOUBLE ||
+        event == Event::POINTER_LEFT_DOWN_LATE;
+}
+
+constexpr SelectInputTransition Reset(bool checkFinished = true)
+{
+    return Make(State::SELECT_INPUT_INITIAL, SubState::SUB_INITIAL, Action::ACTION_NONE, checkFinished);
+}
+
+constexpr SelectInputTransition Begin()
+{
+    return Make(State::SELECT_INPUT_WORD_BEGIN, SubState::SUB_INITIAL, Action::ACTION_BEGIN);
+}
+
+// 复位后按初始状态重新处理当前事件
+constexpr SelectInputTransition ResetAndReplay(Event event)
+{
+    return IsLeftDown(event) ? Begin() : Reset();
+}
+
+constexpr SelectInputTransition JudgeTripleClick(Event event)
+{
+    if (event != Event::POINTER_LEFT_DOWN_IN_TRIPLE) {
+        return Begin();
+    }
+    return Make(State::SELECT_INPUT_WAIT_TRIPLE_CLICK, SubState::SUB_WAIT_POINTER_ACTION_BUTTON_UP,
+        Action::ACTION_STAMP_CLICK);
+}
+
+constexpr SelectInputTransition WordSelection(State state, bool ctrlTriggered)
+{
+    bool isDoubleClick = state == State::SELECT_INPUT_WAIT_DOUBLE_CLICK;
+    if (ctrlTriggered) {
+        return Make(State::SELECT_INPUT_WORD_END,
+            isDoubleClick ? SubState::SUB_WAIT_BUTTON_OR_CTRL_DOWN : SubState::SUB_WAIT_KEY_CTRL_DOWN,
+            Action::ACTION_SAVE_END);
+    }
+    return Make(State::SELECT_INPUT_DONE,
+        isDoubleClick ? SubState::SUB_WAIT_POINTER_ACTION_BUTTON_DOWN : SubState::SUB_INITIAL,
+        Action::ACTION_SAVE_END);
+}
+
+constexpr SelectInputTransition LeftButton(State state, SubState subState, Event event, bool ctrlTriggered)
+{
+    const SelectInputTransition keep = Make(state, subState);
+    switch (state) {
+        case State::SELECT_INPUT_INITIAL:
+            return IsLeftDown(event) ? Begin() : keep;
+        case State::SELECT_INPUT_WORD_BEGIN:
+            if (event == Event::POINTER_LEFT_MOVE) {
+                return Make(State::SELECT_INPUT_WAIT_LEFT_MOVE, SubState::SUB_WAIT_POINTER_ACTION_BUTTON_UP);
+            }
+            if (event == Event::POINTER_LEFT_UP) {
+                return Make(State::SELECT_INPUT_WAIT_DOUBLE_CLICK, SubState::SUB_WAIT_POINTER_ACTION_BUTTON_DOWN);
+            }
+            return keep;
+        case State::SELECT_INPUT_WAIT_LEFT_MOVE:
+            if (event == Event::POINTER_LEFT_UP) {
+                return WordSelection(state, ctrlTriggered);
+            }
+            return event == Event::POINTER_LEFT_MOVE ? keep : ResetAndReplay(event);
+        case State::SELECT_INPUT_WAIT_DOUBLE_CLICK:
+            if (subState == SubState::SUB_WAIT_POINTER_ACTION_BUTTON_DOWN && IsLeftDown(event)) {
+                if (event == Event::POINTER_LEFT_DOWN_LATE) {
+                    return Begin();
+                }
+                return Make(state, SubState::SUB_WAIT_POINTER_ACTION_BUTTON_UP, Action::ACTION_STAMP_CLICK);
+            }
+            if (subState == SubState::SUB_WAIT_POINTER_ACTION_BUTTON_UP) {
+                if (event == Event::POINTER_LEFT_UP) {
+                    return WordSelection(state, ctrlTriggered);
+                }
+                return event == Event::POINTER_LEFT_MOVE ? Make(State::SELECT_INPUT_WAIT_LEFT_MOVE, subState) : keep;
+            }
+            if (subState == SubState::SUB_WAIT_BUTTON_OR_CTRL_DOWN && IsLeftDown(event)) {
+                return JudgeTripleClick(event);
+            }
+            return keep;
+        case State::SELECT_INPUT_WORD_END:
+        case State::SELECT_INPUT_DONE:
+            if (!IsLeftDown(event)) {
+                return Reset();
+            }
+            if (subState != SubState::SUB_WAIT_POINTER_ACTION_BUTTON_DOWN &&
+                subState != SubState::SUB_WAIT_BUTTON_OR_CTRL_DOWN) {
+                return Begin();
+            }
+            return JudgeTripleClick(event);
+        case State::SELECT_INPUT_WAIT_TRIPLE_CLICK:
+            if (IsLeftDown(event)) {
+                return JudgeTripleClick(event);
+            }
+            if (event == Event::POINTER_LEFT_UP) {
+                return WordSelection(state, ctrlTriggered);
+            }
+            return event == Event::POINTER_LEFT_MOVE ? Make(State::SELECT_INPUT_WAIT_LEFT_MOVE, subState) : Reset();
+        default:
+            return keep;
+    }
+}
+
+constexpr SelectInputTransition Hover(State state, SubState subState, Event event)
+{
+    if (subState == SubState::SUB_WAIT_POINTER_ACTION_BUTTON_DOWN && event == Event::POINTER_HOVER_TINY) {
+        return Make(state == State::SELECT_INPUT_DONE ? State::SELECT_INPUT_WAIT_TRIPLE_CLICK : state, subState,
+            Action::ACTION_NONE, false);
+    }
+    if (subState == SubState::SUB_WAIT_KEY_CTRL_DOWN || subState == SubState::SUB_WAIT_KEY_CTRL_UP) {
+        return Make(state, subState, Action::ACTION_NONE, false);
+    }
+    if (subState == SubState::SUB_WAIT_BUTTON_OR_CTRL_DOWN) {
+        return Make(state, SubState::SUB_WAIT_KEY_CTRL_DOWN, Action::ACTION_NONE, false);
+    }
+    return Reset(false);
+}
+
+constexpr SelectInputTransition Key(State state, SubState subState, Event event)
+{
+    const SelectInputTransition ignore = Make(state, subState, Action::ACTION_NONE, false);
+    if (state == State::SELECT_INPUT_DONE) {
+        if (subState != SubState::SUB_INITIAL) {
+            return Make(State::SELECT_INPUT_WORD_END, subState, Action::ACTION_NONE, false);
+        }
+        return Reset(false);
+    }
+    if (subState != SubState::SUB_WAIT_KEY_CTRL_DOWN && subState != SubState::SUB_WAIT_KEY_CTRL_UP &&
+        subState != SubState::SUB_WAIT_BUTTON_OR_CTRL_DOWN) {
+        return ignore;
+    }
+    if (event == Event::KEY_OTHER) {
+        return Reset(false);
+    }
+    if (event == Event::KEY_CTRL_DOWN_REPEAT) {
+        return ignore;
+    }
+    if ((subState == SubState::SUB_WAIT_KEY_CTRL_DOWN || subState == SubState::SUB_WAIT_BUTTON_OR_CTRL_DOWN) &&
+        event == Event::KEY_CTRL_DOWN) {
+        return Make(state, SubState::SUB_WAIT_KEY_CTRL_UP, Action::ACTION_NONE, false);
+    }
+    if (subState == SubState::SUB_WAIT_KEY_CTRL_UP &&
+        (event == Event::KEY_CTRL_UP || event == Event::KEY_CTRL_UP_REPEAT)) {
+        return Make(state == State::SELECT_INPUT_WORD_END ? State::SELECT_INPUT_DONE : state, SubState::SUB_INITIAL);
+    }
+    if (event == Event::KEY_CTRL_UP_REPEAT) {
+        return ignore;
+    }
+    return Reset();
+}
+
+// 划词状态机的规则定义，仅在编译期用于生成转移表，运行期不再走分支判断
+constexpr SelectInputTransition Evaluate(State state, SubState subState, Event event, bool ctrlTriggered)
+{
+    switch (event) {
+        case Event::POINTER_LEFT_DOWN_IN_TRIPLE:
+        case Event::POINTER_LEFT_DOWN_IN_DOUBLE:
+        case Event::POINTER_LEFT_DOWN_LATE:
+        case Event::POINTER_LEFT_UP:
+        case Event::POINTER_LEFT_MOVE:
+        case Event::POINTER_LEFT_OTHER:
+            return LeftButton(state, subState, event, ctrlTriggered);
+        case Event::POINTER_HOVER_TINY:
+        case Event::POINTER_HOVER:
+            return Hover(state, subState, event);
+        case Event::POINTER_OTHER_BUTTON:
+            return Reset(false);
+        case Event::POINTER_IGNORED:
+            return Make(state, subState, Action::ACTION_NONE, false);
+        default:
+            return Key(state, subState, event);
+    }
+}
+} // namespace SelectInputRules
+
+struct SelectTouchTransition {
+    SelectTouchState nextState : 8;
+    SelectInputState publicState : 8;      // 对外呈现的划词状态，复用鼠标路径的后续处理
+    SelectInputSubState publicSubState : 8;
+    SelectInputAction action : 7;
+    bool checkFinished : 1;
+};
+
+namespace SelectTouchRules {
+using TouchState = SelectTouchState;
+using TouchEvent = SelectTouchEvent;
+
+constexpr SelectTouchTransition Make(TouchState state, SelectInputState publicState,
+    SelectInputAction action = SelectInputAction::ACTION_NONE, bool checkFinished = false,
+    SelectInputSubState publicSubState = SelectInputSubState::SUB_INITIAL)
+{
+    return SelectTouchTransition { state, publicState, publicSubState, action, checkFinished };
+}
+
+constexpr SelectTouchTransition Idle()
+{
+    return Make(TouchState::TOUCH_IDLE, SelectInputState::SELECT_INPUT_INITIAL);
+}
+
+// 长按选词对外等同于双击选词，长按后拖动等同于鼠标拖选
+constexpr SelectInputState PublicState(TouchState state)
+{
+    switch (state) {
+        case TouchState::TOUCH_LONG_PRESSED:
+            return SelectInputState::SELECT_INPUT_WAIT_DOUBLE_CLICK;
+        case TouchState::TOUCH_DRAGGING:
+            return SelectInputState::SELECT_INPUT_WAIT_LEFT_MOVE;
+        default:
+            return SelectInputState::SELECT_INPUT_INITIAL;
+    }
+}
+
+constexpr SelectTouchTransition Stay(TouchState state)
+{
+    return Make(state, PublicState(state));
+}
+
+constexpr SelectTouchTransition Finish(bool ctrlTriggered)
+{
+    if (ctrlTriggered) {
+        return Make(TouchState::TOUCH_DONE, SelectInputState::SELECT_INPUT_WORD_END, SelectInputAction::ACTION_SAVE_END,
+            true, SelectInputSubState::SUB_WAIT_KEY_CTRL_DOWN);
+    }
+    return Make(TouchState::TOUCH_DONE, SelectInputState::SELECT_INPUT_DONE, SelectInputAction::ACTION_SAVE_END, true);
+}
+
+constexpr SelectTouchTransition Evaluate(TouchState state, TouchEvent event, bool ctrlTriggered)
+{
+    switch (state) {
+        case TouchState::TOUCH_IDLE:
+        case TouchState::TOUCH_DONE:
+            if (event == TouchEvent::TOUCH_DOWN) {
+                return Make(TouchState::TOUCH_PRESSED, SelectInputState::SELECT_INPUT_INITIAL,
+                    SelectInputAction::ACTION_BEGIN);
+            }
+            return state == TouchState::TOUCH_IDLE ? Stay(state) : Idle();
+        case TouchState::TOUCH_PRESSED:
+            if (event == TouchEvent::TOUCH_MOVE_TINY) {
+                return Stay(state);
+            }
+            if (event == TouchEvent::TOUCH_LONG_PRESS) {
+                return Stay(TouchState::TOUCH_LONG_PRESSED);
+            }
+            // 长按前移动视为滑动，抬起视为点击，多指按下视为手势，均不划词
+            return Idle();
+        case TouchState::TOUCH_LONG_PRESSED:
+        case TouchState::TOUCH_DRAGGING:
+            if (event == TouchEvent::TOUCH_MOVE) {
+                return Stay(TouchState::TOUCH_DRAGGING);
+            }
+            if (event == TouchEvent::TOUCH_MOVE_TINY || event == TouchEvent::TOUCH_LONG_PRESS) {
+                return Stay(state);
+            }
+            if (event == TouchEvent::TOUCH_UP) {
+                return Finish(ctrlTriggered);
+            }
+            return Idle();
+        default:
+            return Idle();
+    }
+}
+} // namespace SelectTouchRules
+
+class SelectTouchTransitionTable {
+public:
+    static constexpr uint32_t TRIGGER_COUNT = 2;
+    static constexpr uint32_t STATE_COUNT = static_cast<uint32_t>(SelectTouchState::TOUCH_STATE_COUNT);
+    static constexpr uint32_t EVENT_COUNT = static_cast<uint32_t>(SelectTouchEvent::TOUCH_EVENT_COUNT);
+    static constexpr uint32_t SIZE = TRIGGER_COUNT * STATE_COUNT * EVENT_COUNT;
+
+    static constexpr uint32_t Index(bool ctrlTriggered, SelectTouchState state, SelectTouchEvent event)
+    {
+        return (static_cast<uint32_t>(ctrlTriggered) * STATE_COUNT + static_cast<uint32_t>(state)) * EVENT_COUNT +
+            static_cast<uint32_t>(event);
+    }
+
+    static constexpr const SelectTouchTransition& Lookup(bool ctrlTriggered, SelectTouchState state,
+        SelectTouchEvent event)
+    {
+        return TABLE[Index(ctrlTriggered, state, event)];
+    }
+
+private:
+    static constexpr std::array<SelectTouchTransition, SIZE> Build();
+    static const std::array<SelectTouchTransition, SIZE> TABLE;
+};
+
+constexpr std::array<SelectTouchTransition, SelectTouchTransitionTable::SIZE> SelectTouchTransitionTable::Build()
+{
+    std::array<SelectTouchTransition, SIZE> table {};
+    for (uint32_t trigger = 0; trigger < TRIGGER_COUNT; ++trigger) {
+        for (uint32_t state = 0; state < STATE_COUNT; ++state) {
+            for (uint32_t event = 0; event < EVENT_COUNT; ++event) {
+                auto s = static_cast<SelectTouchState>(state);
+                auto e = static_cast<SelectTouchEvent>(event);
+                table[Index(trigger != 0, s, e)] = SelectTouchRules::Evaluate(s, e, trigger != 0);
+            }
+        }
+    }
+    return table;
+}
+
+inline constexpr std::array<SelectTouchTransition, SelectTouchTransitionTable::SIZE>
+    SelectTouchTransitionTable::TABLE = SelectTouchTransitionTable::Build();
+
+class SelectInputTransitionTable {
+public:
+    static constexpr uint32_t TRIGGER_COUNT = 2;
+    static constexpr uint32_t STATE_COUNT = static_cast<uint32_t>(SelectInputState::SELECT_INPUT_STATE_COUNT);
+    static constexpr uint32_t SUB_STATE_COUNT = static_cast<uint32_t>(SelectInputSubState::SUB_STATE_COUNT);
+    static constexpr uint32_t EVENT_COUNT = static_cast<uint32_t>(SelectInputEvent::EVENT_COUNT);
+    static constexpr uint32_t SIZE = TRIGGER_COUNT * STATE_COUNT * SUB_STATE_COUNT * EVENT_COUNT;
+
+    static constexpr uint32_t Index(bool ctrlTriggered, SelectInputState state, SelectInputSubState subState,
+        SelectInputEvent event)
+    {
+        return ((static_cast<uint32_t>(ctrlTriggered) * STATE_COUNT + static_cast<uint32_t>(state)) *
+            SUB_STATE_COUNT + static_cast<uint32_t>(subState)) * EVENT_COUNT + static_cast<uint32_t>(event);
+    }
+
+    static constexpr const SelectInputTransition& Lookup(bool ctrlTriggered, SelectInputState state,
+        SelectInputSubState subState, SelectInputEvent event)
+    {
+        return TABLE[Index(ctrlTriggered, state, subState, event)];
+    }
+
+    // 无按键移动在该状态下不会引起任何转移或副作用时返回 true，供输入快速过滤使用
+    static constexpr bool IsHoverInert(SelectInputState state, SelectInputSubState subState)
+    {
+        return (HOVER_INERT_MASK >> (static_cast<uint32_t>(state) * SUB_STATE_COUNT +
+            static_cast<uint32_t>(subState))) & 1u;
+    }
+
+private:
+    static constexpr std::array<SelectInputTransition, SIZE> Build();
+    static constexpr uint64_t BuildHoverInertMask();
+    static const std::array<SelectInputTransition, SIZE> TABLE;
+    static const uint64_t HOVER_INERT_MASK;
+};
+
+constexpr std::array<SelectInputTransition, SelectInputTransitionTable::SIZE> SelectInputTransitionTable::Build()
+{
+    std::array<SelectInputTransition, SIZE> table {};
+    for (uint32_t trigger = 0; trigger < TRIGGER_COUNT; ++trigger) {
+        for (uint32_t state = 0; state < STATE_COUNT; ++state) {
+            for (uint32_t sub = 0; sub < SUB_STATE_COUNT; ++sub) {
+                for (uint32_t event = 0; event < EVENT_COUNT; ++event) {
+                    auto s = static_cast<SelectInputState>(state);
+                    auto ss = static_cast<SelectInputSubState>(sub);
+                    auto e = static_cast<SelectInputEvent>(event);
+                    table[Index(trigger != 0, s, ss, e)] = SelectInputRules::Evaluate(s, ss, e, trigger != 0);
+                }
+            }
+        }
+    }
+    return table;
+}
+
+inline constexpr std::array<SelectInputTransition, SelectInputTransitionTable::SIZE>
+    SelectInputTransitionTable::TABLE = SelectInputTransitionTable::Build();
+
+constexpr uint64_t SelectInputTransitionTable::BuildHoverInertMask()
+{
+    uint64_t mask = 0;
+    for (uint32_t state = 0; state < STATE_COUNT; ++state) {
+        for (uint32_t sub = 0; sub < SUB_STATE_COUNT; ++sub) {
+            auto s = static_cast<SelectInputState>(state);
+            auto ss = static_cast<SelectInputSubState>(sub);
+            bool inert = s != SelectInputState::SELECT_INPUT_DONE;
+            for (uint32_t trigger = 0; trigger < TRIGGER_COUNT; ++trigger) {
+                for (auto e : { SelectInputEvent::POINTER_HOVER, SelectInputEvent::POINTER_HOVER_TINY }) {
+                    const SelectInputTransition& transition = TABLE[Index(trigger != 0, s, ss, e)];
+                    inert = inert && transition.nextState == s && transition.nextSubState == ss &&
+                        transition.action == SelectInputAction::ACTION_NONE && !transition.checkFinished;
+                }
+            }
+            if (inert) {
+                mask |= uint64_t { 1 } << (state * SUB_STATE_COUNT + sub);
+            }
+        }
+    }
+    return mask;
+}
+
+inline constexpr uint64_t SelectInputTransitionTable::HOVER_INERT_MASK =
+    SelectInputTransitionTable::BuildHoverInertMask();
+
+static_assert(sizeof(SelectInputTransition) == sizeof(uint32_t), "transition entry must stay compact");
+static_assert(sizeof(SelectTouchTransition) == sizeof(uint32_t), "touch transition entry must stay compact");
+static_assert(SelectInputTransitionTable::STATE_COUNT * SelectInputTransitionTable::SUB_STATE_COUNT <= 64,
+    "hover inert mask must fit in 64 bits");
+} // namespace OHOS::SelectionFwk
+
+#endif // SELECTION_INPUT_TRANSITION_H
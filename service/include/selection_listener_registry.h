@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SELECTION_LISTENER_REGISTRY_H
+#define SELECTION_LISTENER_REGISTRY_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "iremote_object.h"
+#include "iselection_listener.h"
+#include "selection_notify_batcher.h"
+
+namespace OHOS::SelectionFwk {
+constexpr const size_t MAX_SELECTION_LISTENERS = 8; // 同时注册的监听者上限
+
+class SelectionListenerDeathRecipient : public IRemoteObject::DeathRecipient {
+public:
+    using DiedHandler = std::function<void(const wptr<IRemoteObject>& remote)>;
+
+    explicit SelectionListenerDeathRecipient(const DiedHandler& handler) : handler_(handler) {}
+    void OnRemoteDied(const wptr<IRemoteObject>& remote) override;
+
+private:
+    DiedHandler handler_;
+};
+
+struct SelectionListenerEntry {
+    sptr<ISelectionListener> listener;
+    sptr<IRemoteObject> remote;
+    sptr<SelectionListenerDeathRecipient> deathRecipient;
+    std::shared_ptr<SelectionNotifyBatcher> batcher;
+    uint32_t eventMask = SELECTION_EVENT_MASK_ALL;
+    int32_t pid = -1;
+
+    bool Accepts(SelectionEventType type) const
+    {
+        return (eventMask & SelectionEventMask(type)) != 0;
+    }
+};
+
+// 监听者注册表：注册/注销时复制整张表后整体替换（写时复制），
+// 分发路径只原子读取当前快照，不与注册操作争用锁
+class SelectionListenerRegistry {
+public:
+    using Snapshot = std::shared_ptr<const std::vector<SelectionListenerEntry>>;
+
+    ~SelectionListenerRegistry();
+
+    ErrCode Add(const sptr<ISelectionListener>& listener, uint32_t eventMask, int32_t pid);
+    bool Remove(const sptr<IRemoteObject>& remote);
+    void Clear();
+
+    Snapshot GetSnapshot() const;
+    sptr<ISelectionListener> GetPrimaryListener() const;
+    bool HasListener(uint32_t eventMask) const;
+    size_t Size() const;
+
+    void Post(const SelectionNotifyEvent& event) const;
+    ErrCode PostAndFlush(const SelectionNotifyEvent& event) const;
+
+private:
+    static void Detach(const SelectionListenerEntry& entry);
+
+    std::mutex writeMutex_;
+    Snapshot snapshot_ = std::make_shared<const std::vector<SelectionListenerEntry>>();
+};
+} // namespace OHOS::SelectionFwk
+
+#endif // SELECTION_LISTENER_REGISTRY_H
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SELECTION_NOTIFY_BATCHER_H
+#define SELECTION_NOTIFY_BATCHER_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "errors.h"
+#include "selection_data_inner.h"
+
+namespace OHOS::SelectionFwk {
+constexpr const uint32_t SELECTION_NOTIFY_COALESCE_MS = 30; // 正在发送时未能立即发出的通知的兜底发送时限（毫秒）
+constexpr const size_t SELECTION_NOTIFY_QUEUE_CAPACITY = 64; // 单个监听者待发送通知上限，超出时丢弃最旧的通知
+
+struct SelectionNotifyStats {
+    uint64_t events = 0;
+    uint64_t transactions = 0;
+    uint64_t failures = 0;
+    uint64_t dropped = 0;
+};
+
+// 合并短时间内的监听者通知：划词事件立即发送并带上队列中的事件；
+// 焦点变化等事件只在已有划词事件待发送时并入该批次，否则立即单独发送，不为等待合并而延迟。
+// 有批次正在发送时新事件留在队列中，由当前发送方或兜底定时器随后发出。
+// 每个监听者对应一个有界队列，监听者处理缓慢时丢弃最旧的通知，投递方不会被阻塞。
+// 合并窗口定时器只持有弱引用，须通过 std::shared_ptr 持有
+class SelectionNotifyBatcher : public std::enable_shared_from_this<SelectionNotifyBatcher> {
+public:
+    using Sender = std::function<ErrCode(const SelectionEventBatch& batch)>;
+
+    explicit SelectionNotifyBatcher(const Sender& sender, uint32_t coalesceMs = SELECTION_NOTIFY_COALESCE_MS,
+        size_t capacity = SELECTION_NOTIFY_QUEUE_CAPACITY);
+    ~SelectionNotifyBatcher();
+
+    void Post(const SelectionNotifyEvent& event);
+    ErrCode PostAndFlush(const SelectionNotifyEvent& event);
+    ErrCode Flush();
+    void Clear();
+    SelectionNotifyStats GetStats() const;
+
+private:
+    bool Enqueue(const SelectionNotifyEvent& event);
+    bool TakeBatch(SelectionEventBatch& batch);
+    ErrCode SendPending();
+    void StartTimer();
+    void CancelTimer();
+
+    Sender sender_;
+    uint32_t coalesceMs_;
+    size_t capacity_;
+    // 发送锁保证批次按产生顺序送达，队列锁只保护待发送事件，生产者不会被跨进程调用阻塞
+    std::mutex sendMutex_;
+    mutable std::mutex mutex_;
+    std::vector<SelectionNotifyEvent> pending_;
+    size_t pendingSelections_ = 0; // pending_ 中的划词事件数，受 mutex_ 保护
+    std::atomic<uint32_t> timerId_ {0};
+    std::atomic<uint64_t> eventCount_ {0};
+    std::atomic<uint64_t> transactionCount_ {0};
+    std::atomic<uint64_t> failureCount_ {0};
+    std::atomic<uint64_t> droppedCount_ {0};
+};
+} // namespace OHOS::SelectionFwk
+
+#endif // SELECTION_NOTIFY_BATCHER_H
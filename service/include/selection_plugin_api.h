@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SELECTION_PLUGIN_API_H
+#define SELECTION_PLUGIN_API_H
+
+#include <cstdint>
+
+namespace OHOS::SelectionFwk {
+class SelectionConfig;
+
+// 各插件 .so 仅导出该入口，服务通过一次 dlsym 取得整张接口表
+constexpr const char *SELECTION_PLUGIN_API_SYMBOL = "GetSelectionPluginApi";
+constexpr const uint32_t SELECTION_PLUGIN_API_VERSION = 2;
+
+enum SelectionPluginCapability : uint32_t {
+    SELECTION_PLUGIN_CAP_DATABASE = 1U << 0,
+    SELECTION_PLUGIN_CAP_PASTEBOARD = 1U << 1,
+    SELECTION_PLUGIN_CAP_PASTEBOARD_DUMP = 1U << 2,
+    SELECTION_PLUGIN_CAP_ABILITY_MANAGER = 1U << 3,
+    SELECTION_PLUGIN_CAP_PASTEBOARD_POINT = 1U << 4,
+};
+
+// 选区起点的屏幕坐标，供按坐标定位选区所在控件的内容来源使用
+struct SelectionPluginPoint {
+    int32_t displayX;
+    int32_t displayY;
+};
+
+// 插件接口表，由插件以静态常量提供，生命周期与 .so 相同；
+// 只允许在末尾追加字段并递增版本号，已有字段的顺序和签名保持不变
+struct SelectionPluginApi {
+    uint32_t abiVersion;
+    uint32_t structSize;
+    uint32_t capabilities;
+    void (*cleanup)();  // dlclose 前调用
+
+    // SELECTION_PLUGIN_CAP_DATABASE
+    int (*databaseSaveConfig)(int uid, const SelectionConfig *config);
+    int (*databaseGetConfig)(int uid, SelectionConfig *config);
+    int (*databaseIsAvailable)();
+
+    // SELECTION_PLUGIN_CAP_PASTEBOARD
+    int (*pasteboardGetContent)(char *buffer, int bufferSize, uint32_t windowId, const char *bundleName);
+    int (*pasteboardGetContentFd)(int *fd, uint32_t windowId, const char *bundleName);
+    int (*pasteboardCanGetContent)();
+    void (*pasteboardSetFlag)(int flag);
+
+    // SELECTION_PLUGIN_CAP_PASTEBOARD_DUMP
+    void (*pasteboardDumpStats)(int fd);
+
+    // SELECTION_PLUGIN_CAP_ABILITY_MANAGER
+    int (*abilityConnect)(const void *want, const void *callback, int32_t userId);
+    int (*abilityDisconnect)(const void *callback);
+    int (*abilityIsAvailable)();
+
+    // SELECTION_PLUGIN_CAP_PASTEBOARD_POINT（版本 2）
+    int (*pasteboardGetContentAt)(char *buffer, int bufferSize, uint32_t windowId, const char *bundleName,
+        const SelectionPluginPoint *point);
+    int (*pasteboardGetContentFdAt)(int *fd, uint32_t windowId, const char *bundleName,
+        const SelectionPluginPoint *point);
+};
+
+// 插件按调用方请求的版本返回接口表，不支持该版本时返回 nullptr
+using GetSelectionPluginApiFunc = const SelectionPluginApi *(*)(uint32_t version);
+} // namespace OHOS::SelectionFwk
+
+#endif // SELECTION_PLUGIN_API_H
@@ -16,11 +16,18 @@
 #ifndef SELECTION_SERVICE_H
 #define SELECTION_SERVICE_H
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <map>
+#include <memory>
 #include <mutex>
-#include <shared_mutex>
 #include <future>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "ability_connect_callback_stub.h"
 #include "focus_change_info.h"
@@ -34,7 +41,10 @@
 #include "common_event_subscribe_info.h"
 #include "selection_common.h"
 #include "selection_config_comparator.h"
+#include "selection_content_session.h"
 #include "selection_input_monitor.h"
+#include "selection_listener_registry.h"
+#include "selection_plugin_api.h"
 
 namespace OHOS::SelectionFwk {
 using namespace MMI;
@@ -43,10 +53,15 @@ constexpr const char *BOOTEVENT_BOOT_COMPLETED = "bootevent.boot.completed";
 constexpr const char *SYS_SELECTION_SWITCH = "sys.selection.switch";
 constexpr const char *SYS_SELECTION_TRIGGER = "sys.selection.trigger";
 constexpr const char *SYS_SELECTION_APP = "sys.selection.app";
+constexpr const char *SYS_SELECTION_PREWARM_IDLE = "persist.selection.prewarm.idle_ms";
+constexpr const char *SYS_SELECTION_CONTENT_PREFETCH = "persist.selection.content.prefetch";
 constexpr const char *DEFAULT_SWITCH = "on";
 constexpr const char *DEFAULT_TRIGGER = "ctrl";
 
+constexpr const uint32_t PLUGIN_QUIESCE_POLL_INTERVAL = 1; // 卸载插件时等待在途调用退出的轮询间隔（毫秒）
 constexpr const uint32_t CLEANUP_DELAY_TIME = 50;          // 清理资源与卸载so之间的延迟间隔（毫秒）
+constexpr const int32_t DEFAULT_PREWARM_IDLE_TIMEOUT_MS = 10000; // 预热连接未被使用时的断开时间（毫秒）
+constexpr const int32_t MAX_PREWARM_IDLE_TIMEOUT_MS = 300000;    // 预热空闲时间上限（毫秒）
 
 class SelectionExtensionAbilityConnection : public OHOS::AAFwk::AbilityConnectionStub {
 public:
@@ -94,8 +109,13 @@ public:
 
     ErrCode RegisterListener(const sptr<ISelectionListener>& listener) override;
     ErrCode UnregisterListener(const sptr<ISelectionListener>& listener) override;
+    ErrCode RegisterListenerWithMask(const sptr<ISelectionListener>& listener, uint32_t eventMask) override;
     ErrCode IsCurrentSelectionApp(int pid, bool &resultValue) override;
     ErrCode GetSelectionContent(std::string& selectionContent) override;
+    ErrCode GetSelectionContentFd(int& contentFd) override;
+    ErrCode OpenSelectionContent(uint32_t& contentLength) override;
+    ErrCode ReadSelectionContentChunk(uint32_t offset, uint32_t maxLength, std::string& chunk) override;
+    ErrCode CloseSelectionContent() override;
     int32_t Dump(int32_t fd, const std::vector<std::u16string> &args) override;
     int32_t ConnectNewExtAbility(const std::string& bundleName, const std::string& abilityName);
     int32_t ReconnectExtAbility(const std::string& bundleName, const std::string& abilityName);
@@ -107,18 +127,36 @@ public:
     bool IsAnySelectionPanelShowing();
 
     sptr<ISelectionListener> GetListener();
+    bool HasListener(uint32_t eventMask) const;
     void PersistSelectionConfig();
     void HandleCommonEvent(const EventFwk::CommonEventData &data);
     bool GetScreenLockedFlag();
     void WatchExtAbilityInstalled(const std::string& bundleName, const std::string& abilityName);
 
-    // 剪贴板操作方法（供 SelectionInputMonitor 调用）
-    int GetPasteboardContent(std::string& content, uint32_t windowId, const std::string& bundleName);
+    // 剪贴板操作方法（供 SelectionInputMonitor 调用），point 为选区起点坐标，插件按坐标定位选区所在控件
+    int GetPasteboardContent(std::string& content, uint32_t windowId, const std::string& bundleName,
+        const SelectionPluginPoint* point = nullptr);
+    int GetPasteboardContentFd(int32_t& contentFd, uint32_t windowId, const std::string& bundleName,
+        const SelectionPluginPoint* point = nullptr);
     bool CanGetPasteboardContent();
     void SetPasteboardFlag(bool flag);
 
-    // 插件卸载定时器管理（供SelectionInputMonitor 调用）
-    void ResetPluginUnloadTimer();
+    // 插件保活：只刷新最近使用时间，由周期巡检统一卸载空闲插件（供SelectionInputMonitor 调用）
+    void KeepPluginsAlive();
+
+    // 划词开始时预热扩展连接，划词完成时取预热结果（供 SelectionInputMonitor 在划词工作线程调用）
+    void PrewarmExtAbility();
+    int32_t WaitPrewarmedExtAbility();
+
+    // 划词完成时与通知监听者并行预取选中内容，按划词序号缓存最近一次结果（供 SelectionInputMonitor 调用）
+    void PrefetchSelectionContent(uint32_t seqId, uint32_t windowId, const std::string& bundleName,
+        const SelectionPluginPoint& point);
+    bool TakePrefetchedContent(uint32_t seqId, std::string& content, int32_t& result);
+
+    // 监听者通知：按订阅类型分发给各监听者；焦点变化进入合并窗口，划词事件携带窗口内的事件立即发送
+    // （供 SelectionInputMonitor 调用）
+    void NotifyFocusChange(const SelectionFocusChangeInfo& focusChangeInfo);
+    ErrCode NotifySelection(const SelectionInfo& selectionInfo);
 
     // 数据库配置操作方法（供 SelectionConfigComparator 调用）
     int GetDatabaseConfig(int32_t uid, SelectionConfig& config);
@@ -142,6 +180,8 @@ private:
     void InitFocusChangedMonitor();
     void CancelFocusChangedMonitor();
     void HandleFocusChanged(const sptr<Rosen::FocusChangeInfo> &focusChangeInfo, bool isFocused);
+    void DumpWorkerStats(int32_t fd, const SelectionWorkerStats &stats);
+    void DumpTraceCommand(int32_t fd, const std::string &option);
     void SynchronizeSelectionConfig();
 
     // 配置同步辅助函数
@@ -150,26 +190,141 @@ private:
     void SyncConfigToDatabase(int32_t userId, const SelectionConfig& config);
     void ProcessSyncResult(const ComparisionResult& result);
 
-    static constexpr const char* PLUGIN_SO_PATH = "libselection_plugins_impl.z.so";
+    // 插件按模块拆分为独立 .so，首次使用时按需加载，各自计时卸载
+    enum PluginModule : uint32_t {
+        PLUGIN_DATABASE = 0,
+        PLUGIN_PASTEBOARD,
+        PLUGIN_ABILITY_MANAGER,
+        PLUGIN_MODULE_COUNT,
+    };
+    static constexpr const char* PLUGIN_SO_PATHS[PLUGIN_MODULE_COUNT] = {
+        "libselection_database_plugin.z.so",
+        "libselection_pasteboard_plugin.z.so",
+        "libselection_ability_plugin.z.so",
+    };
+    static constexpr uint32_t PLUGIN_MODULE_CAPABILITIES[PLUGIN_MODULE_COUNT] = {
+        SELECTION_PLUGIN_CAP_DATABASE,
+        SELECTION_PLUGIN_CAP_PASTEBOARD,
+        SELECTION_PLUGIN_CAP_ABILITY_MANAGER,
+    };
+    static constexpr const char* PLUGIN_MODULE_NAMES[PLUGIN_MODULE_COUNT] = { "database", "pasteboard", "ability" };
     static constexpr uint32_t PLUGIN_UNLOAD_TIMEOUT_MS = 300000;  // 5分钟卸载超时
-    bool LoadPluginSo();
+    static constexpr uint32_t PLUGIN_REAPER_INTERVAL_MS = 60000;  // 空闲巡检周期，插件空闲5~6分钟后卸载
+    static constexpr uint32_t PLUGIN_LOAD_RETRY_TIMES = 3;  // 取接口表时遇到并发卸载的重新加载次数
+
+    // 插件的一次加载实例：读者计数按实例区分，重新加载后旧实例的回收只等待仍持有旧接口表的调用
+    struct PluginGeneration {
+        PluginGeneration(void* soHandle, const SelectionPluginApi* pluginApi) : handle(soHandle), api(pluginApi) {}
+
+        void* handle = nullptr;
+        const SelectionPluginApi* api = nullptr;
+        std::atomic<uint32_t> readers {0};  // 持有本实例接口表的在途调用数
+    };
+
+    // 插件模块状态：当前实例由 mutex 串行发布和摘除，调用方通过 std::atomic_load 读取
+    struct PluginModuleState {
+        std::shared_ptr<PluginGeneration> generation;  // 仅通过 std::atomic_load/std::atomic_store 访问
+        std::atomic<int64_t> lastUsedMs {0};  // 最近使用时间（单调时钟毫秒），仅用于空闲判断
+        std::shared_future<void> reclaimFuture;  // 后台回收（等待在途调用、cleanup、dlclose）的完成状态
+        std::shared_ptr<PluginGeneration> reclaiming;  // 正在回收的实例，与 reclaimFuture 一起由 mutex 保护
+        std::mutex mutex;
+
+        std::shared_ptr<PluginGeneration> Current() const
+        {
+            return std::atomic_load(&generation);
+        }
+        const SelectionPluginApi* GetApi() const
+        {
+            auto current = Current();
+            return current == nullptr ? nullptr : current->api;
+        }
+    };
+
+    // 在途调用登记：先增加所取实例的读者计数再复核实例仍在发布，卸载方摘除实例后等待其计数归零才 dlclose
+    class PluginApiGuard {
+    public:
+        explicit PluginApiGuard(PluginModuleState& plugin) : generation_(plugin.Current())
+        {
+            if (generation_ == nullptr) {
+                return;
+            }
+            generation_->readers.fetch_add(1, std::memory_order_seq_cst);
+            // 登记与摘除都是顺序一致操作：要么这里看到实例已被摘除，要么回收方看到本次登记
+            if (plugin.Current() != generation_) {
+                generation_->readers.fetch_sub(1, std::memory_order_release);
+                generation_ = nullptr;
+                return;
+            }
+            api_ = generation_->api;
+            HeldGenerations().push_back(generation_.get());
+        }
+        PluginApiGuard(PluginApiGuard&& other) noexcept
+            : generation_(std::move(other.generation_)), api_(other.api_)
+        {
+            other.api_ = nullptr;
+        }
+        ~PluginApiGuard()
+        {
+            if (generation_ == nullptr) {
+                return;
+            }
+            auto& held = HeldGenerations();
+            auto iter = std::find(held.rbegin(), held.rend(), generation_.get());
+            if (iter != held.rend()) {
+                held.erase(std::next(iter).base());
+            }
+            generation_->readers.fetch_sub(1, std::memory_order_release);
+        }
+        PluginApiGuard(const PluginApiGuard&) = delete;
+        PluginApiGuard& operator=(const PluginApiGuard&) = delete;
+        PluginApiGuard& operator=(PluginApiGuard&&) = delete;
+
+        explicit operator bool() const
+        {
+            return api_ != nullptr;
+        }
+        const SelectionPluginApi* operator->() const
+        {
+            return api_;
+        }
+        // 当前线程是否持有该实例的读者计数；持有时不能等待该实例回收，否则自身阻塞回收
+        static bool IsHeldByCurrentThread(const PluginGeneration* generation)
+        {
+            const auto& held = HeldGenerations();
+            return generation != nullptr && std::find(held.begin(), held.end(), generation) != held.end();
+        }
+
+    private:
+        static std::vector<const PluginGeneration*>& HeldGenerations()
+        {
+            thread_local std::vector<const PluginGeneration*> held;
+            return held;
+        }
+
+        std::shared_ptr<PluginGeneration> generation_;  // 移动后由新对象负责释放读者计数
+        const SelectionPluginApi* api_ = nullptr;
+    };
+
+    bool LoadPluginSo(PluginModule module);
+    const SelectionPluginApi* ResolvePluginApi(PluginModule module, void* handle);
+    PluginApiGuard AcquirePluginApi(PluginModule module);
+    void UnloadPluginSo(PluginModule module);
     void UnloadPluginSo();
-    void OnPluginUnloadTimer();
-
-    // 数据库操作函数指针类型
-    using DatabaseSaveConfigFunc = int(*)(int, const SelectionConfig*);
-    using DatabaseGetConfigFunc = int(*)(int, SelectionConfig*);
-    using DatabaseIsAvailableFunc = int(*)();
-
-    // 剪贴板函数指针类型
-    using PasteboardGetContentFunc = int(*)(char*, int, uint32_t, const char*);
-    using PasteboardCanGetContentFunc = int(*)();
-    using PasteboardSetFlagFunc = void(*)(int);
-
-    // 能力管理操作函数指针类型
-    using AbilityManagerConnectFunc = int(*)(const void*, const void*, int32_t);
-    using AbilityManagerDisconnectFunc = int(*)(const void*);
-    using AbilityManagerIsAvailableFunc = int(*)();
+    void ReclaimPluginSo(PluginModule module, const std::shared_ptr<PluginGeneration>& generation);
+    static void AwaitPluginReclaim(PluginModuleState& plugin, std::unique_lock<std::mutex>& lock);
+    void WaitPluginSoReclaimed();
+    void StartPluginReaper();
+    void StopPluginReaper();
+    void OnPluginReaperTick();
+    static int64_t GetPluginClockMs();
+    void ResetPrewarmIdleTimer();
+    void StartPrewarmIdleTimerLocked();
+    void CancelPrewarmIdleTimer();
+    void OnPrewarmIdleTimer(const std::shared_ptr<uint32_t>& timerId);
+    void RunPrefetchWorker();
+    void StopPrefetchWorker();
+    void DumpListeners(int32_t fd);
+    void DumpPluginStats(int32_t fd);
 
     int GetUserId();
     int LoadAccountLocalId();
@@ -182,23 +337,13 @@ private:
     std::map<int32_t, std::function<void(int32_t, const std::string&)>> systemAbilityChangeHandlers_;
     std::shared_ptr<SelectionInputMonitor> inputMonitor_;
 
-    // 插件 .so 句柄和函数指针
-    void* pluginSo_ = nullptr;
-    std::atomic<uint32_t> pluginUnloadTimerId_ {0};  // 插件自动卸载定时器ID
-    DatabaseSaveConfigFunc databaseSave_ = nullptr;
-    DatabaseGetConfigFunc databaseGet_ = nullptr;
-    DatabaseIsAvailableFunc databaseAvailable_ = nullptr;
-    AbilityManagerConnectFunc abilityConnect_ = nullptr;
-    AbilityManagerDisconnectFunc abilityDisconnect_ = nullptr;
-    AbilityManagerIsAvailableFunc abilityAvailable_ = nullptr;
-    PasteboardGetContentFunc pasteboardGetContent_ = nullptr;
-    PasteboardCanGetContentFunc pasteboardCanGetContent_ = nullptr;
-    PasteboardSetFlagFunc pasteboardSetFlag_ = nullptr;
+    std::array<PluginModuleState, PLUGIN_MODULE_COUNT> plugins_;
+    std::mutex pluginReaperMutex_;
+    uint32_t pluginReaperTimerId_ = 0;  // 空闲巡检定时器ID，有插件加载时才注册
 
     int32_t inputMonitorId_ {-1};
     mutable std::mutex mutex_;
-    mutable std::shared_mutex pluginMutex_;
-    static sptr<ISelectionListener> listener_;
+    SelectionListenerRegistry listenerRegistry_;
     sptr<SelectionExtensionAbilityConnection> connectInner_ {nullptr};
     std::mutex connectMutex_;
     std::atomic<int> pid_ = -1;
@@ -209,6 +354,37 @@ private:
     bool isMonitorInitialized_ = false;
     bool isWindowInitialized_ = false;
     bool isCommonEventInitialized_ = false;
+
+    // 扩展连接预热状态
+    std::mutex prewarmMutex_;
+    std::shared_future<int32_t> prewarmFuture_;
+    bool isPrewarmPending_ = false;
+    std::atomic<uint32_t> prewarmIdleTimerId_ {0};
+    std::atomic<int32_t> prewarmIdleTimeoutMs_ {DEFAULT_PREWARM_IDLE_TIMEOUT_MS};
+    std::atomic<uint64_t> prewarmStartedCount_ {0};
+    std::atomic<uint64_t> prewarmUsedCount_ {0};
+    std::atomic<uint64_t> prewarmCancelledCount_ {0};
+
+    // 选中内容分块读取会话
+    SelectionContentSession contentSession_;
+
+    // 选中内容预取（单槽缓存，按划词序号匹配），由常驻预取线程执行，与通知监听者并行
+    using PrefetchResult = std::pair<int32_t, std::string>;
+    std::mutex prefetchMutex_;
+    uint32_t prefetchSeqId_ = 0;
+    std::shared_future<PrefetchResult> prefetchFuture_;
+    std::promise<PrefetchResult> prefetchPromise_;
+    bool prefetchQueued_ = false;
+    bool prefetchStopping_ = false;
+    uint32_t prefetchWindowId_ = 0;
+    std::string prefetchBundleName_;
+    SelectionPluginPoint prefetchPoint_ {};
+    std::condition_variable prefetchCv_;
+    std::thread prefetchWorker_;
+    std::atomic<bool> contentPrefetchEnabled_ = false;
+    std::atomic<uint64_t> prefetchStartedCount_ {0};
+    std::atomic<uint64_t> prefetchHitCount_ {0};
+    std::atomic<uint64_t> prefetchMissCount_ {0};
 };
 }
 
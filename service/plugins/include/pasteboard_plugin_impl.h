@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include "selection_plugin_api.h"
 
 namespace OHOS {
 namespace SelectionFwk {
@@ -36,12 +37,14 @@ public:
     int GetModuleVersion();
 
     bool InitPasteboard();
-    int32_t GetSelectionContent(std::string& content, uint32_t windowId, const std::string& bundleName);
+    int32_t GetSelectionContent(std::string& content, uint32_t windowId, const std::string& bundleName,
+        uint32_t maxLength = 0, const SelectionPluginPoint* point = nullptr);
     bool CanGetSelectionContent() const;
     void SetCanGetSelectionContentFlag(bool flag);
     bool IsAvailable() const;
     bool HealthCheck() const;
     const char* GetStatus() const;
+    void DumpStats(int32_t fd) const;
 
 private:
     std::shared_ptr<SelectionPasteboardManager> pasteboardManager_;
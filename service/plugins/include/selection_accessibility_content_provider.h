@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SELECTION_ACCESSIBILITY_CONTENT_PROVIDER_H
+#define SELECTION_ACCESSIBILITY_CONTENT_PROVIDER_H
+
+#include "selection_content_provider.h"
+
+namespace OHOS::Accessibility {
+class AccessibilityElementInfo;
+} // namespace OHOS::Accessibility
+
+namespace OHOS::SelectionFwk {
+// 通过 AccessibleAbilityClient 读取选区起点所在控件的选中区间，无需模拟 Ctrl+C。
+// 连接状态由无障碍连接监听回调维护，未连接时跳过该来源并回退到模拟复制。
+class SelectionAccessibilityContentProvider : public SelectionContentProvider {
+public:
+    SelectionAccessibilityContentProvider();
+
+    const char *GetName() const override;
+    bool IsAvailable(const SelectionContentQuery& query) const override;
+    int32_t GetContent(const SelectionContentQuery& query, std::string& content) override;
+
+private:
+    // 自根节点按坐标逐层命中子节点，返回路径上最深的带选区元素
+    bool FindSelectedElementAt(const SelectionContentQuery& query,
+        Accessibility::AccessibilityElementInfo& selected) const;
+};
+} // namespace OHOS::SelectionFwk
+
+#endif // SELECTION_ACCESSIBILITY_CONTENT_PROVIDER_H
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SELECTION_CONTENT_PROVIDER_H
+#define SELECTION_CONTENT_PROVIDER_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace OHOS::SelectionFwk {
+constexpr const int32_t ACCESSIBILITY_CONTENT_PROVIDER_PRIORITY = 10;
+constexpr const int32_t SYNTHETIC_COPY_CONTENT_PROVIDER_PRIORITY = 100;
+constexpr const size_t MAX_CONTENT_PROVIDER_STATS_BUNDLES = 64;
+
+struct SelectionContentQuery {
+    uint32_t windowId = 0;
+    std::string bundleName;
+    uint32_t maxLength = 0;
+    // 选区起点的屏幕坐标，调用方未提供时 hasPoint 为 false
+    bool hasPoint = false;
+    int32_t displayX = 0;
+    int32_t displayY = 0;
+};
+
+// 选中内容来源：按优先级依次尝试，前一个来源取不到内容时回退到下一个
+class SelectionContentProvider {
+public:
+    virtual ~SelectionContentProvider() = default;
+
+    virtual const char *GetName() const = 0;
+    // 返回 false 时本次请求跳过该来源，不计入失败
+    virtual bool IsAvailable(const SelectionContentQuery& query) const = 0;
+    virtual int32_t GetContent(const SelectionContentQuery& query, std::string& content) = 0;
+};
+
+// 按 UTF-16 码元区间截取 UTF-8 文本，控件上报的选区偏移以 UTF-16 码元计数；
+// 区间越界或边界落在代理对中间时返回 false
+bool Utf8SubstrByUtf16Range(const std::string& text, size_t begin, size_t length, std::string& result);
+
+struct SelectionContentProviderUsage {
+    uint64_t served = 0;
+    uint64_t failed = 0;
+    uint64_t totalUs = 0;
+    uint64_t maxUs = 0;
+};
+
+struct SelectionContentProviderStats {
+    std::string name;
+    int32_t priority = 0;
+    SelectionContentProviderUsage usage;
+};
+
+class SelectionContentProviderChain {
+public:
+    // priority 越小越优先，同名来源重复注册时替换原有来源
+    void Register(const std::shared_ptr<SelectionContentProvider>& provider, int32_t priority);
+    void Unregister(const std::string& name);
+    int32_t GetContent(const SelectionContentQuery& query, std::string& content);
+
+    std::vector<SelectionContentProviderStats> GetStats() const;
+    std::map<std::string, SelectionContentProviderUsage> GetBundleStats(const std::string& bundleName) const;
+    void Dump(int32_t fd) const;
+
+private:
+    struct ProviderEntry {
+        int32_t priority = 0;
+        std::shared_ptr<SelectionContentProvider> provider;
+    };
+
+    struct BundleUsage {
+        uint64_t lastUpdate = 0;
+        std::map<std::string, SelectionContentProviderUsage> providers;
+    };
+
+    std::vector<ProviderEntry> GetProviders() const;
+    void RecordResult(const std::string& name, const std::string& bundleName, bool served, int64_t costUs);
+    static void Accumulate(SelectionContentProviderUsage& usage, bool served, uint64_t costUs);
+
+    mutable std::mutex mutex_;
+    std::vector<ProviderEntry> providers_;
+    std::map<std::string, SelectionContentProviderUsage> providerUsage_;
+    std::map<std::string, BundleUsage> bundleUsage_;
+    uint64_t updateCounter_ = 0;
+};
+} // namespace OHOS::SelectionFwk
+
+#endif // SELECTION_CONTENT_PROVIDER_H
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SELECTION_INJECT_TIMING_H
+#define SELECTION_INJECT_TIMING_H
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace OHOS::SelectionFwk {
+constexpr const uint32_t DEFAULT_INJECT_HOLD_US = 60000;  // 未学习到响应时间前 C 抬起后保持 Ctrl 的时长
+constexpr const uint32_t MIN_INJECT_HOLD_US = 5000;
+constexpr const uint32_t MAX_INJECT_HOLD_US = 60000;
+constexpr const uint32_t INJECT_HOLD_MARGIN_US = 5000;
+constexpr const uint32_t DEFAULT_PASTEBOARD_WAIT_US = 110000; // 未学习到响应时间前等待剪贴板回调的时长
+constexpr const uint32_t MIN_PASTEBOARD_WAIT_US = 30000;
+constexpr const uint32_t MAX_PASTEBOARD_WAIT_US = 300000;
+constexpr const uint32_t PASTEBOARD_WAIT_MARGIN_US = 10000;
+constexpr const size_t INJECT_TIMING_WINDOW_SIZE = 32;    // 每个应用保留的最近响应样本数
+constexpr const size_t INJECT_TIMING_MIN_SAMPLES = 5;     // 样本数达到后才按分位数调整
+constexpr const uint32_t INJECT_TIMING_MAX_TIMEOUT_SHIFT = 3;
+constexpr const size_t MAX_INJECT_TIMING_BUNDLES = 64;
+static_assert(MAX_INJECT_HOLD_US + PASTEBOARD_WAIT_MARGIN_US <= MAX_PASTEBOARD_WAIT_US,
+    "wait budget must be able to cover the longest hold");
+
+struct SelectionInjectTiming {
+    uint32_t holdUs = DEFAULT_INJECT_HOLD_US;
+    uint32_t waitUs = DEFAULT_PASTEBOARD_WAIT_US;
+};
+
+struct SelectionBundleTimingStats {
+    std::string bundleName;
+    size_t samples = 0;
+    uint32_t p50Us = 0;
+    uint32_t p90Us = 0;
+    uint32_t p99Us = 0;
+    uint32_t timeoutStreak = 0;
+    uint64_t timeouts = 0;
+    SelectionInjectTiming timing;
+};
+
+// 按应用学习从注入 Ctrl+C 到剪贴板回调的响应时间分位数，
+// 据此设置 Ctrl 保持时长与等待回调的预算，两者都有固定的上下限；
+// 等待预算自注入开始计时，且不小于保持时长加余量，保证 Ctrl 抬起前不会判定超时
+class SelectionInjectTimingController {
+public:
+    SelectionInjectTiming GetTiming(const std::string& bundleName) const;
+    void RecordResponse(const std::string& bundleName, int64_t latencyUs);
+    // 超时后连续加倍等待预算，直到下一次成功响应
+    void RecordTimeout(const std::string& bundleName);
+    std::vector<SelectionBundleTimingStats> GetStats() const;
+
+    static SelectionInjectTiming ComputeTiming(size_t samples, uint32_t p90Us, uint32_t p99Us,
+        uint32_t timeoutStreak);
+
+private:
+    struct BundleTiming {
+        std::array<uint32_t, INJECT_TIMING_WINDOW_SIZE> samples {};
+        size_t count = 0;
+        size_t next = 0;
+        uint32_t p50Us = 0;
+        uint32_t p90Us = 0;
+        uint32_t p99Us = 0;
+        uint32_t timeoutStreak = 0;
+        uint64_t timeouts = 0;
+        uint64_t lastUpdate = 0;
+        SelectionInjectTiming timing;
+    };
+
+    BundleTiming& GetOrCreateLocked(const std::string& bundleName);
+    static void UpdatePercentiles(BundleTiming& bundle);
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, BundleTiming> bundles_;
+    uint64_t updateCounter_ = 0;
+};
+} // namespace OHOS::SelectionFwk
+
+#endif // SELECTION_INJECT_TIMING_H
@@ -16,32 +16,125 @@
 #ifndef SELECTION_PASTEBOARD_MANAGER_H
 #define SELECTION_PASTEBOARD_MANAGER_H
 
+#include <array>
 #include <string>
 #include <mutex>
+#include <chrono>
 #include <condition_variable>
+#include <map>
 #include <memory>
+#include <thread>
 #include "pasteboard_client.h"
+#include "selection_plugin_api.h"
 #include <linux/input.h>
 #include <linux/uinput.h>
 #include <future>
 #include <atomic>
 #include <refbase.h>
+#include "selection_content_provider.h"
+#include "selection_event_queue.h"
+#include "selection_inject_timing.h"
 
 namespace OHOS::SelectionFwk {
 using namespace OHOS::MiscServices;
 
+class SelectionPasteboardManager;
+
 // SelectionPasteboardDisposableObserver - moved from original module
+// 每次取词请求使用独立的观察者，回调结果按请求 ID 投递给对应的请求。
+// 观察者由 PasteboardClient 持有，其代码位于插件内，卸载插件前需等待全部观察者释放
 class SelectionPasteboardDisposableObserver : public PasteboardDisposableObserver {
 public:
     SelectionPasteboardDisposableObserver();
-    virtual ~SelectionPasteboardDisposableObserver() = default;
+    virtual ~SelectionPasteboardDisposableObserver();
+
+    // 等待所有观察者析构，超时返回 false
+    static bool WaitAllReleased(std::chrono::milliseconds timeout);
 
     void SetBundleName(const std::string& bundleName);
+    void SetRequest(uint64_t requestId, const std::weak_ptr<SelectionPasteboardManager>& manager);
     void OnTextReceived(const std::string &text, int32_t errCode) override;
     bool IsAllWhitespace(const std::string &str);
 
 private:
     std::string bundleName_ = "";
+    uint64_t requestId_ = 0;
+    std::weak_ptr<SelectionPasteboardManager> manager_;
+};
+
+struct SelectionPasteboardResult {
+    int32_t errCode = 0;
+    std::string text;
+    bool injectFailed = false;
+    int64_t latencyUs = -1; // 注入到回调的耗时，未注入时为 -1
+    bool cancelled = false; // 插件清理时被取消
+};
+
+// 单次取词请求的完成槽位：只接受第一次完成，之后到达的结果被丢弃
+class SelectionPasteboardRequest {
+public:
+    explicit SelectionPasteboardRequest(uint64_t id);
+
+    uint64_t GetId() const;
+    bool Complete(SelectionPasteboardResult result);
+    bool WaitFor(std::chrono::microseconds timeout) const;
+    // 先等待注入线程取出请求，再自注入开始计时等待回调，排队时间不占用回调预算
+    bool WaitForResponse(std::chrono::microseconds queueTimeout, std::chrono::microseconds waitTimeout) const;
+    SelectionPasteboardResult GetResult() const;
+    void MarkInjected(int64_t timeUs);
+    int64_t GetInjectTimeUs() const;
+
+private:
+    uint64_t id_;
+    std::atomic<bool> completed_ { false };
+    std::atomic<int64_t> injectTimeUs_ { 0 };
+    mutable std::mutex stateMutex_;
+    mutable std::condition_variable stateCv_;
+    std::promise<SelectionPasteboardResult> promise_;
+    std::shared_future<SelectionPasteboardResult> future_;
+};
+
+constexpr const size_t INJECT_QUEUE_CAPACITY = 16; // 待注入请求队列容量
+constexpr const uint32_t INJECT_QUEUE_TIMEOUT_US = 200000; // 等待注入线程取出请求的上限
+constexpr const size_t INJECT_LATENCY_BUCKET_COUNT = 8;
+// 注入耗时分布的桶上界（毫秒），最后一个桶收容超过全部上界的样本
+constexpr const std::array<int64_t, INJECT_LATENCY_BUCKET_COUNT - 1> INJECT_LATENCY_BUCKET_BOUNDS_MS = {
+    10, 20, 40, 60, 80, 100, 150
+};
+
+// 注入 Ctrl+C 到收到剪贴板回调的耗时直方图
+class SelectionInjectLatencyHistogram {
+public:
+    void Record(int64_t costUs);
+    std::array<uint64_t, INJECT_LATENCY_BUCKET_COUNT> GetBuckets() const;
+    uint64_t GetCount() const;
+    uint64_t GetTotalUs() const;
+    uint64_t GetMaxUs() const;
+
+private:
+    std::array<std::atomic<uint64_t>, INJECT_LATENCY_BUCKET_COUNT> buckets_ {};
+    std::atomic<uint64_t> count_ { 0 };
+    std::atomic<uint64_t> totalUs_ { 0 };
+    std::atomic<uint64_t> maxUs_ { 0 };
+};
+
+struct SelectionInjectTask {
+    uint64_t requestId = 0;
+    int64_t enqueueTimeUs = 0;
+    uint32_t holdUs = DEFAULT_INJECT_HOLD_US;
+};
+
+// 兜底来源：模拟 Ctrl+C 后通过一次性剪贴板观察者取回文本
+class SelectionSyntheticCopyProvider : public SelectionContentProvider {
+public:
+    explicit SelectionSyntheticCopyProvider(const std::weak_ptr<SelectionPasteboardManager>& manager);
+
+    const char *GetName() const override;
+    bool IsAvailable(const SelectionContentQuery& query) const override;
+    int32_t GetContent(const SelectionContentQuery& query, std::string& content) override;
+
+private:
+    std::weak_ptr<SelectionPasteboardManager> manager_;
 };
 
 // Main manager class - encapsulates all pasteboard functionality
@@ -53,8 +146,9 @@ public:
     // Initialize the pasteboard manager with base input monitor
     bool Initialize();
 
-    // Get selection content from pasteboard
-    int32_t GetSelectionContent(std::string& selectionContent, uint32_t windowId, const std::string& bundleName);
+    // Get selection content from pasteboard, maxLength 为 0 时使用默认长度上限，point 为选区起点坐标（可为空）
+    int32_t GetSelectionContent(std::string& selectionContent, uint32_t windowId, const std::string& bundleName,
+        uint32_t maxLength = 0, const SelectionPluginPoint* point = nullptr);
 
     // Check if can get selection content
     bool CanGetSelectionContent() const;
@@ -63,15 +157,38 @@ public:
     // Cleanup resources
     void Cleanup();
 
+    // 将剪贴板回调结果投递给对应请求，请求已结束（如超时）时丢弃
+    void OnTextReceived(uint64_t requestId, const std::string& text, int32_t errCode);
+
+    // 按优先级注册选中内容来源，模拟 Ctrl+C 的来源在 Initialize 时以最低优先级注册
+    void RegisterContentProvider(const std::shared_ptr<SelectionContentProvider>& provider, int32_t priority);
+
+    // 输出注入线程与内容来源的统计信息到 dump fd
+    void DumpStats(int32_t fd) const;
+
 private:
+    friend class SelectionSyntheticCopyProvider;
+
+    // 模拟 Ctrl+C 并等待剪贴板回调
+    int32_t GetContentBySyntheticCopy(const SelectionContentQuery& query, std::string& selectionContent);
+
     // Initialize virtual keyboard device
     bool InitUidev();
 
     // Inject Ctrl+C using virtual keyboard
-    int32_t InjectCtrlC() const;
+    int32_t InjectCtrlC(uint32_t holdUs) const;
 
-    // Wait for any pending async InjectCtrlC to complete
-    void WaitForPendingAsync();
+    // 常驻注入线程：启动后复用同一个 uinput fd，直到 Cleanup
+    void StartInjectWorker();
+    void StopInjectWorker();
+    void RunInjectWorker();
+    bool PostInjectTask(uint64_t requestId, uint32_t holdUs = DEFAULT_INJECT_HOLD_US);
+    void InjectForRequest(const SelectionInjectTask& task);
+
+    std::shared_ptr<SelectionPasteboardRequest> CreateRequest();
+    void CancelPendingRequests();
+    std::shared_ptr<SelectionPasteboardRequest> FindRequest(uint64_t requestId);
+    void RemoveRequest(uint64_t requestId);
 
     // Convert pasteboard error codes to service error codes
     int32_t PasteBoardErrorCodeToSelectionService(int32_t pasteBoardErrCode);
@@ -79,17 +196,31 @@ private:
     // Helper functions
 
     // Member variables
-    sptr<SelectionPasteboardDisposableObserver> pasteboardObserver_;
-
     // Virtual keyboard
     bool initialized_;
     int32_t fd_;
     struct uinput_user_dev uidev_;
     std::atomic<bool> canGetSelectionContentFlag_;
-    // Async injection state
-    std::future<int32_t> injectCtrlCFuture_;
-    std::atomic<bool> injectFailed_;
-    std::atomic<bool> injectCtrlCRunning_;
+    // Per-request state
+    std::atomic<uint64_t> nextRequestId_;
+    std::mutex requestsMutex_;
+    std::map<uint64_t, std::shared_ptr<SelectionPasteboardRequest>> pendingRequests_;
+    // 注入线程状态：IPC 线程与预取线程并发入队，注入线程单独出队，两端均无锁；
+    // injectProducers_ 记录正在入队的生产者，停止时等其归零后再清空队列
+    MpscRingBuffer<SelectionInjectTask, INJECT_QUEUE_CAPACITY> injectQueue_;
+    std::atomic<uint32_t> injectProducers_ { 0 };
+    std::thread injectWorker_;
+    std::mutex injectWaitMutex_;
+    std::condition_variable injectCv_;
+    std::atomic<bool> injectRunning_ { false };
+    std::atomic<bool> injectWaiting_ { false };
+    std::atomic<uint64_t> injectCount_ { 0 };
+    std::atomic<uint64_t> injectDropped_ { 0 };
+    std::atomic<uint64_t> injectSkipped_ { 0 };
+    std::atomic<uint64_t> injectFailed_ { 0 };
+    SelectionInjectLatencyHistogram injectLatency_;
+    SelectionInjectTimingController injectTiming_;
+    SelectionContentProviderChain providerChain_;
     std::weak_ptr<SelectionPasteboardManager> self_weak_;
 };
 
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ability_manager_plugin_impl.h"
+#include "selection_log.h"
+#include "selection_plugin_api.h"
+#include "iremote_object.h"
+#include "ability_connect_callback_stub.h"
+#include "want.h"
+#include <memory>
+#include <mutex>
+
+using namespace OHOS;
+using namespace OHOS::SelectionFwk;
+
+// 能力管理插件实例，仅由 libselection_ability_plugin.z.so 持有
+namespace {
+    std::unique_ptr<AbilityManagerPluginImpl> g_abilityManagerPlugin;
+    std::mutex g_abilityManagerMutex;
+    bool g_abilityManagerInitialized = false;
+
+    bool EnsureAbilityManagerPlugin()
+    {
+        std::lock_guard<std::mutex> lock(g_abilityManagerMutex);
+        if (!g_abilityManagerInitialized) {
+            g_abilityManagerPlugin = std::make_unique<AbilityManagerPluginImpl>();
+            g_abilityManagerInitialized = g_abilityManagerPlugin->Initialize();
+            SELECTION_HILOGI("AbilityManager plugin %{public}s",
+                             g_abilityManagerInitialized ? "initialized" : "failed");
+        }
+        return g_abilityManagerInitialized;
+    }
+}
+
+// 模块函数通过接口表提供给 selection_service，符号本身不导出
+extern "C" {
+
+// Want 和 callback 作为指针传递，具体结构由调用方和实现方约定
+int AbilityManagerConnectAbility(const void* want, const void* callback, int32_t userId)
+{
+    if (!want || !callback) {
+        SELECTION_HILOGE("AbilityManagerConnectAbility: invalid parameters");
+        return -1;
+    }
+    if (!EnsureAbilityManagerPlugin()) {
+        return -1;
+    }
+    // 需要 reinterpret_cast 因为外部是 C 调用
+    auto wantPtr = reinterpret_cast<const AAFwk::Want*>(want);
+    auto callbackPtr = reinterpret_cast<const sptr<AAFwk::AbilityConnectionStub>*>(callback);
+    return g_abilityManagerPlugin->ConnectAbility(*wantPtr, *callbackPtr, userId);
+}
+
+int AbilityManagerDisconnectAbility(const void* callback)
+{
+    if (!callback) {
+        SELECTION_HILOGE("AbilityManagerDisconnectAbility: callback is null");
+        return -1;
+    }
+    if (!EnsureAbilityManagerPlugin()) {
+        return -1;
+    }
+    auto callbackPtr = reinterpret_cast<const sptr<AAFwk::AbilityConnectionStub>*>(callback);
+    return g_abilityManagerPlugin->DisconnectAbility(*callbackPtr);
+}
+
+int AbilityManagerIsAvailable()
+{
+    return g_abilityManagerInitialized && g_abilityManagerPlugin->IsAvailable() ? 1 : 0;
+}
+
+// 清理能力管理插件资源（在 dlclose 前调用）
+void AbilityManagerPluginCleanup()
+{
+    std::lock_guard<std::mutex> lock(g_abilityManagerMutex);
+    if (g_abilityManagerPlugin) {
+        g_abilityManagerPlugin->Cleanup();
+        g_abilityManagerPlugin.reset();
+        g_abilityManagerInitialized = false;
+    }
+    SELECTION_HILOGI("AbilityManager plugin cleanup completed");
+}
+
+const SelectionPluginApi* GetAbilityManagerPluginApi(uint32_t version)
+{
+    if (version == 0 || version > SELECTION_PLUGIN_API_VERSION) {
+        SELECTION_HILOGE("Unsupported ability manager plugin api version: %{public}u", version);
+        return nullptr;
+    }
+    static const SelectionPluginApi api = [] {
+        SelectionPluginApi table {};
+        table.abiVersion = SELECTION_PLUGIN_API_VERSION;
+        table.structSize = sizeof(SelectionPluginApi);
+        table.capabilities = SELECTION_PLUGIN_CAP_ABILITY_MANAGER;
+        table.cleanup = AbilityManagerPluginCleanup;
+        table.abilityConnect = AbilityManagerConnectAbility;
+        table.abilityDisconnect = AbilityManagerDisconnectAbility;
+        table.abilityIsAvailable = AbilityManagerIsAvailable;
+        return table;
+    }();
+    return &api;
+}
+} // extern "C"
+
+// 单元测试把各模块聚合到同一目标中链接，此时不定义同名入口
+#ifndef SELECTION_PLUGIN_AGGREGATE_BUILD
+extern "C" __attribute__((visibility("default"))) const SelectionPluginApi* GetSelectionPluginApi(uint32_t version)
+{
+    return GetAbilityManagerPluginApi(version);
+}
+#endif
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "database_plugin_impl.h"
+#include "selection_log.h"
+#include "selection_plugin_api.h"
+#include "selection_errors.h"
+#include <memory>
+#include <mutex>
+
+using namespace OHOS;
+using namespace OHOS::SelectionFwk;
+
+// 数据库插件实例，仅由 libselection_database_plugin.z.so 持有
+namespace {
+    std::unique_ptr<DatabasePluginImpl> g_databasePlugin;
+    std::mutex g_databaseMutex;
+    bool g_databaseInitialized = false;
+
+    bool EnsureDatabasePlugin()
+    {
+        std::lock_guard<std::mutex> lock(g_databaseMutex);
+        if (!g_databaseInitialized) {
+            g_databasePlugin = std::make_unique<DatabasePluginImpl>();
+            g_databaseInitialized = g_databasePlugin->Initialize();
+            SELECTION_HILOGI("Database plugin %{public}s",
+                             g_databaseInitialized ? "initialized" : "failed");
+        }
+        return g_databaseInitialized;
+    }
+}
+
+// 模块函数通过接口表提供给 selection_service，符号本身不导出
+extern "C" {
+
+int DatabaseSaveConfig(int uid, const SelectionConfig* config)
+{
+    if (!config) {
+        SELECTION_HILOGE("DatabaseSaveConfig: config is null");
+        return SELECTION_CONFIG_FAILURE;
+    }
+    if (!EnsureDatabasePlugin()) {
+        return SELECTION_CONFIG_RDB_NO_INIT;
+    }
+    return g_databasePlugin->Save(uid, *config);
+}
+
+// 返回值: 0=成功, -1=未找到, -2=未初始化
+int DatabaseGetConfig(int uid, SelectionConfig* config)
+{
+    if (!config) {
+        SELECTION_HILOGE("DatabaseGetConfig: config is null");
+        return SELECTION_CONFIG_FAILURE;
+    }
+    if (!EnsureDatabasePlugin()) {
+        return SELECTION_CONFIG_RDB_NO_INIT;
+    }
+    auto result = g_databasePlugin->GetOneByUserId(uid);
+    if (result.has_value()) {
+        *config = result.value();
+        return 0;
+    }
+    return SELECTION_CONFIG_NOT_FOUND;
+}
+
+int DatabaseIsAvailable()
+{
+    return g_databaseInitialized && g_databasePlugin &&
+           g_databasePlugin->IsAvailable() ? 1 : 0;
+}
+
+// 清理数据库插件资源（在 dlclose 前调用）
+void DatabasePluginCleanup()
+{
+    std::lock_guard<std::mutex> lock(g_databaseMutex);
+    if (g_databasePlugin) {
+        g_databasePlugin->Cleanup();
+        g_databasePlugin.reset();
+        g_databaseInitialized = false;
+    }
+    SELECTION_HILOGI("Database plugin cleanup completed");
+}
+
+const SelectionPluginApi* GetDatabasePluginApi(uint32_t version)
+{
+    if (version == 0 || version > SELECTION_PLUGIN_API_VERSION) {
+        SELECTION_HILOGE("Unsupported database plugin api version: %{public}u", version);
+        return nullptr;
+    }
+    static const SelectionPluginApi api = [] {
+        SelectionPluginApi table {};
+        table.abiVersion = SELECTION_PLUGIN_API_VERSION;
+        table.structSize = sizeof(SelectionPluginApi);
+        table.capabilities = SELECTION_PLUGIN_CAP_DATABASE;
+        table.cleanup = DatabasePluginCleanup;
+        table.databaseSaveConfig = DatabaseSaveConfig;
+        table.databaseGetConfig = DatabaseGetConfig;
+        table.databaseIsAvailable = DatabaseIsAvailable;
+        return table;
+    }();
+    return &api;
+}
+} // extern "C"
+
+// 单元测试把各模块聚合到同一目标中链接，此时不定义同名入口
+#ifndef SELECTION_PLUGIN_AGGREGATE_BUILD
+extern "C" __attribute__((visibility("default"))) const SelectionPluginApi* GetSelectionPluginApi(uint32_t version)
+{
+    return GetDatabasePluginApi(version);
+}
+#endif
@@ -61,14 +61,14 @@ bool PasteboardPluginImpl::InitPasteboard()
 }
 
 int32_t PasteboardPluginImpl::GetSelectionContent(std::string& content, uint32_t windowId,
-    const std::string& bundleName)
+    const std::string& bundleName, uint32_t maxLength, const SelectionPluginPoint* point)
 {
     SELECTION_HILOGI("PasteboardPluginImpl::GetSelectionContent called, windowId=%{public}u", windowId);
     if (pasteboardManager_ == nullptr) {
         SELECTION_HILOGE("PasteboardManager not initialized");
         return -1;
     }
-    return pasteboardManager_->GetSelectionContent(content, windowId, bundleName);
+    return pasteboardManager_->GetSelectionContent(content, windowId, bundleName, maxLength, point);
 }
 
 bool PasteboardPluginImpl::CanGetSelectionContent() const
@@ -110,5 +110,12 @@ const char* PasteboardPluginImpl::GetStatus() const
     return "available";
 }
 
+void PasteboardPluginImpl::DumpStats(int32_t fd) const
+{
+    if (pasteboardManager_ != nullptr) {
+        pasteboardManager_->DumpStats(fd);
+    }
+}
+
 } // namespace SelectionFwk
 } // namespace OHOS
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pasteboard_plugin_impl.h"
+#include "selection_log.h"
+#include "selection_plugin_api.h"
+#include "selection_errors.h"
+#include "securec.h"
+#include "selection_content_shm.h"
+#include <algorithm>
+#include <memory>
+#include <mutex>
+
+using namespace OHOS;
+using namespace OHOS::SelectionFwk;
+
+// 剪贴板插件实例，仅由 libselection_pasteboard_plugin.z.so 持有
+namespace {
+    std::unique_ptr<PasteboardPluginImpl> g_pasteboardPlugin;
+    std::mutex g_pasteboardMutex;
+    bool g_pasteboardInitialized = false;
+
+    bool EnsurePasteboardPlugin()
+    {
+        std::lock_guard<std::mutex> lock(g_pasteboardMutex);
+        if (!g_pasteboardInitialized) {
+            g_pasteboardPlugin = std::make_unique<PasteboardPluginImpl>();
+            g_pasteboardInitialized = g_pasteboardPlugin->Initialize();
+            SELECTION_HILOGI("Pasteboard plugin %{public}s",
+                             g_pasteboardInitialized ? "initialized" : "failed");
+        }
+        return g_pasteboardInitialized;
+    }
+}
+
+// 模块函数通过接口表提供给 selection_service，符号本身不导出
+extern "C" {
+
+// point 为选区起点坐标，可为空；为空时按坐标定位的内容来源不参与
+int PasteboardGetSelectionContentAt(char* buffer, int bufferSize, uint32_t windowId, const char* bundleName,
+    const SelectionPluginPoint* point)
+{
+    if (!buffer || bufferSize <= 0) {
+        SELECTION_HILOGE("PasteboardGetSelectionContent: invalid buffer");
+        return -1;
+    }
+    if (!EnsurePasteboardPlugin()) {
+        return -1;
+    }
+    std::string content;
+    std::string bundleNameStr = bundleName ? bundleName : "";
+    int ret = g_pasteboardPlugin->GetSelectionContent(content, windowId, bundleNameStr, 0, point);
+    if (ret == 0) {
+        int copyLen = std::min(bufferSize - 1, static_cast<int>(content.size()));
+        errno_t err = memcpy_s(buffer, bufferSize, content.c_str(), copyLen);
+        if (err != 0) {
+            SELECTION_HILOGE("memcpy_s failed, err=%{public}d", err);
+            return -1;
+        }
+        buffer[copyLen] = '\0';
+    }
+    return ret;
+}
+
+int PasteboardGetSelectionContent(char* buffer, int bufferSize, uint32_t windowId, const char* bundleName)
+{
+    return PasteboardGetSelectionContentAt(buffer, bufferSize, windowId, bundleName, nullptr);
+}
+
+// 选中内容写入只读共享内存后通过 fd 返回，内容长度不再受调用方缓冲区限制
+int PasteboardGetSelectionContentFdAt(int* fd, uint32_t windowId, const char* bundleName,
+    const SelectionPluginPoint* point)
+{
+    if (!fd) {
+        SELECTION_HILOGE("PasteboardGetSelectionContentFd: fd is null");
+        return -1;
+    }
+    *fd = -1;
+    if (!EnsurePasteboardPlugin()) {
+        return -1;
+    }
+    std::string content;
+    std::string bundleNameStr = bundleName ? bundleName : "";
+    int ret = g_pasteboardPlugin->GetSelectionContent(content, windowId, bundleNameStr,
+        MAX_SELECTION_CONTENT_SHM_LENGTH, point);
+    if (ret == 0) {
+        *fd = CreateSelectionContentShm(content);
+        if (*fd < 0) {
+            SELECTION_HILOGE("Create selection content shared memory failed, size: %{public}zu", content.size());
+            return -1;
+        }
+    }
+    return ret;
+}
+
+int PasteboardGetSelectionContentFd(int* fd, uint32_t windowId, const char* bundleName)
+{
+    return PasteboardGetSelectionContentFdAt(fd, windowId, bundleName, nullptr);
+}
+
+int PasteboardCanGetSelectionContent()
+{
+    if (!EnsurePasteboardPlugin()) {
+        return 0;
+    }
+    return g_pasteboardPlugin->CanGetSelectionContent() ? 1 : 0;
+}
+
+void PasteboardSetCanGetSelectionContentFlag(int flag)
+{
+    if (!EnsurePasteboardPlugin()) {
+        return;
+    }
+    g_pasteboardPlugin->SetCanGetSelectionContentFlag(flag != 0);
+}
+
+int PasteboardIsAvailable()
+{
+    return g_pasteboardInitialized && g_pasteboardPlugin ? 1 : 0;
+}
+
+// 仅在插件已初始化时输出统计信息，不为 dump 触发初始化
+void PasteboardDumpStats(int fd)
+{
+    std::lock_guard<std::mutex> lock(g_pasteboardMutex);
+    if (g_pasteboardInitialized && g_pasteboardPlugin) {
+        g_pasteboardPlugin->DumpStats(fd);
+    }
+}
+
+// 清理剪贴板插件资源（在 dlclose 前调用）
+void PasteboardPluginCleanup()
+{
+    std::lock_guard<std::mutex> lock(g_pasteboardMutex);
+    if (g_pasteboardPlugin) {
+        g_pasteboardPlugin->Cleanup();
+        g_pasteboardPlugin.reset();
+        g_pasteboardInitialized = false;
+    }
+    SELECTION_HILOGI("Pasteboard plugin cleanup completed");
+}
+
+const SelectionPluginApi* GetPasteboardPluginApi(uint32_t version)
+{
+    if (version == 0 || version > SELECTION_PLUGIN_API_VERSION) {
+        SELECTION_HILOGE("Unsupported pasteboard plugin api version: %{public}u", version);
+        return nullptr;
+    }
+    static const SelectionPluginApi api = [] {
+        SelectionPluginApi table {};
+        table.abiVersion = SELECTION_PLUGIN_API_VERSION;
+        table.structSize = sizeof(SelectionPluginApi);
+        table.capabilities = SELECTION_PLUGIN_CAP_PASTEBOARD | SELECTION_PLUGIN_CAP_PASTEBOARD_DUMP |
+            SELECTION_PLUGIN_CAP_PASTEBOARD_POINT;
+        table.cleanup = PasteboardPluginCleanup;
+        table.pasteboardGetContent = PasteboardGetSelectionContent;
+        table.pasteboardGetContentFd = PasteboardGetSelectionContentFd;
+        table.pasteboardCanGetContent = PasteboardCanGetSelectionContent;
+        table.pasteboardSetFlag = PasteboardSetCanGetSelectionContentFlag;
+        table.pasteboardDumpStats = PasteboardDumpStats;
+        table.pasteboardGetContentAt = PasteboardGetSelectionContentAt;
+        table.pasteboardGetContentFdAt = PasteboardGetSelectionContentFdAt;
+        return table;
+    }();
+    return &api;
+}
+} // extern "C"
+
+// 单元测试把各模块聚合到同一目标中链接，此时不定义同名入口
+#ifndef SELECTION_PLUGIN_AGGREGATE_BUILD
+extern "C" __attribute__((visibility("default"))) const SelectionPluginApi* GetSelectionPluginApi(uint32_t version)
+{
+    return GetPasteboardPluginApi(version);
+}
+#endif
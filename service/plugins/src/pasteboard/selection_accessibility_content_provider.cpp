@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "selection_accessibility_content_provider.h"
+
+#include <algorithm>
+#include <atomic>
+#include <dlfcn.h>
+#include <memory>
+#include <vector>
+#include "accessibility_element_info.h"
+#include "accessibility_window_info.h"
+#include "accessible_ability_client.h"
+#include "accessible_ability_listener.h"
+#include "selection_errors.h"
+#include "selection_log.h"
+
+namespace OHOS::SelectionFwk {
+namespace {
+constexpr int32_t MAX_HIT_TEST_DEPTH = 32;
+
+enum class ConnectionState : int32_t {
+    DISCONNECTED,
+    CONNECTING,
+    CONNECTED,
+};
+
+// 连接状态只由无障碍子系统的连接/断开回调更新，Connect() 返回仅表示请求已发出
+class SelectionAccessibilityListener : public Accessibility::AccessibleAbilityListener {
+public:
+    void OnAbilityConnected() override
+    {
+        SELECTION_HILOGI("Accessibility ability connected.");
+        state_.store(ConnectionState::CONNECTED);
+    }
+
+    void OnAbilityDisconnected() override
+    {
+        SELECTION_HILOGW("Accessibility ability disconnected.");
+        state_.store(ConnectionState::DISCONNECTED);
+    }
+
+    void OnAccessibilityEvent(const Accessibility::AccessibilityEventInfo& eventInfo) override {}
+
+    bool OnKeyPressEvent(const std::shared_ptr<MMI::KeyEvent>& keyEvent) override
+    {
+        return false;
+    }
+
+    bool IsConnected() const
+    {
+        return state_.load() == ConnectionState::CONNECTED;
+    }
+
+    // 仅在已断开时发起一次连接，连接中或已连接时不重复请求
+    void RequestConnect()
+    {
+        ConnectionState expected = ConnectionState::DISCONNECTED;
+        if (!state_.compare_exchange_strong(expected, ConnectionState::CONNECTING)) {
+            return;
+        }
+        auto client = Accessibility::AccessibleAbilityClient::GetInstance();
+        if (client == nullptr || client->Connect() != Accessibility::RET_OK) {
+            SELECTION_HILOGW("Failed to request accessibility connection.");
+            expected = ConnectionState::CONNECTING;
+            state_.compare_exchange_strong(expected, ConnectionState::DISCONNECTED);
+        }
+    }
+
+private:
+    std::atomic<ConnectionState> state_ { ConnectionState::DISCONNECTED };
+};
+
+// 客户端单例不提供注销监听的接口，会一直持有监听对象；
+// 本模块因此常驻进程，避免插件卸载后回调落到已释放的代码上
+void PinCurrentModule()
+{
+    Dl_info info {};
+    if (dladdr(reinterpret_cast<void *>(&PinCurrentModule), &info) == 0 || info.dli_fname == nullptr) {
+        SELECTION_HILOGE("Failed to locate accessibility provider module.");
+        return;
+    }
+    if (dlopen(info.dli_fname, RTLD_NOW | RTLD_NOLOAD | RTLD_NODELETE) == nullptr) {
+        SELECTION_HILOGE("Failed to pin accessibility provider module.");
+    }
+}
+
+// 监听对象全进程一份，插件重新加载后继续复用已注册的监听
+std::shared_ptr<SelectionAccessibilityListener> GetListener()
+{
+    static std::shared_ptr<SelectionAccessibilityListener> listener = [] {
+        auto instance = std::make_shared<SelectionAccessibilityListener>();
+        auto client = Accessibility::AccessibleAbilityClient::GetInstance();
+        if (client == nullptr || client->RegisterAbilityListener(instance) != Accessibility::RET_OK) {
+            SELECTION_HILOGE("Failed to register accessibility listener.");
+            return std::shared_ptr<SelectionAccessibilityListener>();
+        }
+        PinCurrentModule();
+        return instance;
+    }();
+    return listener;
+}
+
+bool HasSelection(const Accessibility::AccessibilityElementInfo& element)
+{
+    return element.GetSelectedBegin() >= 0 && element.GetSelectedEnd() > element.GetSelectedBegin();
+}
+
+bool ContainsPoint(const Accessibility::AccessibilityElementInfo& element, int32_t x, int32_t y)
+{
+    const Accessibility::Rect& rect = element.GetRectInScreen();
+    return x >= rect.GetLeftTopXScreenPostion() && x < rect.GetRightBottomXScreenPostion() &&
+        y >= rect.GetLeftTopYScreenPostion() && y < rect.GetRightBottomYScreenPostion();
+}
+} // namespace
+
+SelectionAccessibilityContentProvider::SelectionAccessibilityContentProvider()
+{
+    auto listener = GetListener();
+    if (listener != nullptr) {
+        listener->RequestConnect();
+    }
+}
+
+const char *SelectionAccessibilityContentProvider::GetName() const
+{
+    return "accessibility";
+}
+
+bool SelectionAccessibilityContentProvider::IsAvailable(const SelectionContentQuery& query) const
+{
+    if (query.bundleName.empty() || !query.hasPoint) {
+        return false;
+    }
+    auto listener = GetListener();
+    if (listener == nullptr) {
+        return false;
+    }
+    if (!listener->IsConnected()) {
+        // 断开后由下一次请求重新发起连接，本次回退到其他来源
+        listener->RequestConnect();
+        return false;
+    }
+    return true;
+}
+
+int32_t SelectionAccessibilityContentProvider::GetContent(const SelectionContentQuery& query, std::string& content)
+{
+    Accessibility::AccessibilityElementInfo elementInfo;
+    if (!FindSelectedElementAt(query, elementInfo) || elementInfo.IsPassword()) {
+        return SelectionServiceError::CANNOT_GET_CONTENT;
+    }
+    int32_t begin = elementInfo.GetSelectedBegin();
+    int32_t end = elementInfo.GetSelectedEnd();
+    std::string selected;
+    if (!Utf8SubstrByUtf16Range(elementInfo.GetContent(), static_cast<size_t>(begin),
+        static_cast<size_t>(end - begin), selected)) {
+        return SelectionServiceError::CANNOT_GET_CONTENT;
+    }
+    if (query.maxLength != 0 && selected.size() > query.maxLength) {
+        return SelectionServiceError::CONTENT_OUT_OF_RANGE;
+    }
+    content = std::move(selected);
+    return ERR_OK;
+}
+
+bool SelectionAccessibilityContentProvider::FindSelectedElementAt(const SelectionContentQuery& query,
+    Accessibility::AccessibilityElementInfo& selected) const
+{
+    auto client = Accessibility::AccessibleAbilityClient::GetInstance();
+    if (client == nullptr) {
+        return false;
+    }
+    Accessibility::AccessibilityWindowInfo windowInfo;
+    Accessibility::AccessibilityElementInfo current;
+    if (client->GetWindow(static_cast<int32_t>(query.windowId), windowInfo) != Accessibility::RET_OK ||
+        client->GetRootByWindow(windowInfo, current) != Accessibility::RET_OK) {
+        return false;
+    }
+    bool found = false;
+    for (int32_t depth = 0; depth < MAX_HIT_TEST_DEPTH; ++depth) {
+        if (HasSelection(current)) {
+            selected = current;
+            found = true;
+        }
+        std::vector<Accessibility::AccessibilityElementInfo> children;
+        if (current.GetChildCount() <= 0 || client->GetChildren(current, children) != Accessibility::RET_OK) {
+            break;
+        }
+        // 后绘制的兄弟节点位于上层，逆序取第一个命中的可见节点
+        auto hit = std::find_if(children.rbegin(), children.rend(), [&query](const auto& child) {
+            return child.IsVisible() && ContainsPoint(child, query.displayX, query.displayY);
+        });
+        if (hit == children.rend()) {
+            break;
+        }
+        current = *hit;
+    }
+    return found;
+}
+} // namespace OHOS::SelectionFwk
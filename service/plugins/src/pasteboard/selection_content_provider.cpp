@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "selection_content_provider.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include "selection_errors.h"
+#include "selection_log.h"
+
+namespace OHOS::SelectionFwk {
+namespace {
+int64_t GetMonotonicTimeUs()
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::microseconds>(now).count();
+}
+
+constexpr uint8_t UTF8_CONTINUATION_MASK = 0xC0;
+constexpr uint8_t UTF8_CONTINUATION_BYTE = 0x80;
+constexpr uint8_t UTF8_FOUR_BYTE_LEAD = 0xF0;
+constexpr size_t UTF16_SURROGATE_PAIR_UNITS = 2;
+
+uint64_t AverageUs(const SelectionContentProviderUsage& usage)
+{
+    return usage.served == 0 ? 0 : usage.totalUs / usage.served;
+}
+
+// 从 pos 处前进一个码点，units 累加该码点占用的 UTF-16 码元数
+size_t NextCodePoint(const std::string& text, size_t pos, size_t& units)
+{
+    units += static_cast<uint8_t>(text[pos]) >= UTF8_FOUR_BYTE_LEAD ? UTF16_SURROGATE_PAIR_UNITS : 1;
+    ++pos;
+    while (pos < text.size() &&
+        (static_cast<uint8_t>(text[pos]) & UTF8_CONTINUATION_MASK) == UTF8_CONTINUATION_BYTE) {
+        ++pos;
+    }
+    return pos;
+}
+
+// 返回第 target 个 UTF-16 码元对应的字节偏移，越界或落在代理对中间时返回 false
+bool SeekUtf16Unit(const std::string& text, size_t target, size_t& pos, size_t& units)
+{
+    while (units < target) {
+        if (pos >= text.size()) {
+            return false;
+        }
+        pos = NextCodePoint(text, pos, units);
+    }
+    return units == target;
+}
+} // namespace
+
+bool Utf8SubstrByUtf16Range(const std::string& text, size_t begin, size_t length, std::string& result)
+{
+    if (length == 0) {
+        return false;
+    }
+    size_t pos = 0;
+    size_t units = 0;
+    if (!SeekUtf16Unit(text, begin, pos, units)) {
+        return false;
+    }
+    size_t start = pos;
+    if (!SeekUtf16Unit(text, begin + length, pos, units)) {
+        return false;
+    }
+    result = text.substr(start, pos - start);
+    return true;
+}
+
+void SelectionContentProviderChain::Register(const std::shared_ptr<SelectionContentProvider>& provider,
+    int32_t priority)
+{
+    if (provider == nullptr) {
+        return;
+    }
+    std::string name = provider->GetName();
+    std::lock_guard<std::mutex> lock(mutex_);
+    providers_.erase(std::remove_if(providers_.begin(), providers_.end(),
+        [&name](const ProviderEntry& entry) { return name == entry.provider->GetName(); }), providers_.end());
+    ProviderEntry entry;
+    entry.priority = priority;
+    entry.provider = provider;
+    // 同优先级按注册顺序排列
+    auto pos = std::upper_bound(providers_.begin(), providers_.end(), priority,
+        [](int32_t value, const ProviderEntry& item) { return value < item.priority; });
+    providers_.insert(pos, entry);
+    SELECTION_HILOGI("Register content provider %{public}s, priority: %{public}d.", name.c_str(), priority);
+}
+
+void SelectionContentProviderChain::Unregister(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    providers_.erase(std::remove_if(providers_.begin(), providers_.end(),
+        [&name](const ProviderEntry& entry) { return name == entry.provider->GetName(); }), providers_.end());
+}
+
+int32_t SelectionContentProviderChain::GetContent(const SelectionContentQuery& query, std::string& content)
+{
+    int32_t ret = SelectionServiceError::CANNOT_GET_CONTENT;
+    // 在快照上调用来源，取内容期间不持有锁
+    for (const auto& entry : GetProviders()) {
+        if (!entry.provider->IsAvailable(query)) {
+            continue;
+        }
+        std::string name = entry.provider->GetName();
+        int64_t startUs = GetMonotonicTimeUs();
+        std::string result;
+        ret = entry.provider->GetContent(query, result);
+        int64_t costUs = GetMonotonicTimeUs() - startUs;
+        bool served = ret == ERR_OK && !result.empty();
+        RecordResult(name, query.bundleName, served, costUs);
+        if (served) {
+            SELECTION_HILOGI("Content of %{public}s served by %{public}s in %{public}" PRId64 "us.",
+                query.bundleName.c_str(), name.c_str(), costUs);
+            content = std::move(result);
+            return ERR_OK;
+        }
+        SELECTION_HILOGW("Content provider %{public}s failed: %{public}d, cost %{public}" PRId64 "us.",
+            name.c_str(), ret, costUs);
+        if (ret == ERR_OK) {
+            ret = SelectionServiceError::CANNOT_GET_CONTENT;
+        }
+    }
+    return ret;
+}
+
+std::vector<SelectionContentProviderStats> SelectionContentProviderChain::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<SelectionContentProviderStats> stats;
+    for (const auto& entry : providers_) {
+        SelectionContentProviderStats item;
+        item.name = entry.provider->GetName();
+        item.priority = entry.priority;
+        auto iter = providerUsage_.find(item.name);
+        if (iter != providerUsage_.end()) {
+            item.usage = iter->second;
+        }
+        stats.push_back(item);
+    }
+    return stats;
+}
+
+std::map<std::string, SelectionContentProviderUsage> SelectionContentProviderChain::GetBundleStats(
+    const std::string& bundleName) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = bundleUsage_.find(bundleName);
+    if (iter == bundleUsage_.end()) {
+        return {};
+    }
+    return iter->second.providers;
+}
+
+void SelectionContentProviderChain::Dump(int32_t fd) const
+{
+    for (const auto& stats : GetStats()) {
+        dprintf(fd, "pasteboard.provider[%s]: priority=%d served=%" PRIu64 " failed=%" PRIu64 " avgUs=%" PRIu64
+            " maxUs=%" PRIu64 "\n", stats.name.c_str(), stats.priority, stats.usage.served, stats.usage.failed,
+            AverageUs(stats.usage), stats.usage.maxUs);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& [bundleName, bundle] : bundleUsage_) {
+        std::string line;
+        for (const auto& [name, usage] : bundle.providers) {
+            line += " " + name + ":served=" + std::to_string(usage.served) + ",failed=" +
+                std::to_string(usage.failed) + ",avgUs=" + std::to_string(AverageUs(usage));
+        }
+        dprintf(fd, "pasteboard.provider.bundle[%s]:%s\n", bundleName.c_str(), line.c_str());
+    }
+}
+
+std::vector<SelectionContentProviderChain::ProviderEntry> SelectionContentProviderChain::GetProviders() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return providers_;
+}
+
+void SelectionContentProviderChain::RecordResult(const std::string& name, const std::string& bundleName,
+    bool served, int64_t costUs)
+{
+    uint64_t cost = costUs > 0 ? static_cast<uint64_t>(costUs) : 0;
+    std::lock_guard<std::mutex> lock(mutex_);
+    Accumulate(providerUsage_[name], served, cost);
+    auto iter = bundleUsage_.find(bundleName);
+    if (iter == bundleUsage_.end()) {
+        if (bundleUsage_.size() >= MAX_CONTENT_PROVIDER_STATS_BUNDLES) {
+            // 淘汰最久未更新的应用
+            auto oldest = std::min_element(bundleUsage_.begin(), bundleUsage_.end(),
+                [](const auto& lhs, const auto& rhs) { return lhs.second.lastUpdate < rhs.second.lastUpdate; });
+            bundleUsage_.erase(oldest);
+        }
+        iter = bundleUsage_.emplace(bundleName, BundleUsage()).first;
+    }
+    iter->second.lastUpdate = ++updateCounter_;
+    Accumulate(iter->second.providers[name], served, cost);
+}
+
+void SelectionContentProviderChain::Accumulate(SelectionContentProviderUsage& usage, bool served, uint64_t costUs)
+{
+    if (!served) {
+        usage.failed++;
+        return;
+    }
+    usage.served++;
+    usage.totalUs += costUs;
+    usage.maxUs = std::max(usage.maxUs, costUs);
+}
+} // namespace OHOS::SelectionFwk
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "selection_inject_timing.h"
+
+#include <algorithm>
+#include "selection_log.h"
+
+namespace OHOS::SelectionFwk {
+namespace {
+constexpr uint32_t PERCENT_50 = 50;
+constexpr uint32_t PERCENT_90 = 90;
+constexpr uint32_t PERCENT_99 = 99;
+constexpr uint32_t PERCENT_100 = 100;
+constexpr uint64_t WAIT_SCALE_NUMERATOR = 3;
+constexpr uint64_t WAIT_SCALE_DENOMINATOR = 2;
+
+uint32_t Percentile(const std::vector<uint32_t>& sorted, uint32_t percent)
+{
+    size_t index = (sorted.size() - 1) * percent / PERCENT_100;
+    return sorted[index];
+}
+} // namespace
+
+SelectionInjectTiming SelectionInjectTimingController::GetTiming(const std::string& bundleName) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = bundles_.find(bundleName);
+    if (iter == bundles_.end()) {
+        return SelectionInjectTiming();
+    }
+    return iter->second.timing;
+}
+
+void SelectionInjectTimingController::RecordResponse(const std::string& bundleName, int64_t latencyUs)
+{
+    uint32_t latency = static_cast<uint32_t>(std::clamp<int64_t>(latencyUs, 0, MAX_PASTEBOARD_WAIT_US));
+    std::lock_guard<std::mutex> lock(mutex_);
+    BundleTiming& bundle = GetOrCreateLocked(bundleName);
+    bundle.samples[bundle.next] = latency;
+    bundle.next = (bundle.next + 1) % INJECT_TIMING_WINDOW_SIZE;
+    bundle.count = std::min(bundle.count + 1, INJECT_TIMING_WINDOW_SIZE);
+    bundle.timeoutStreak = 0;
+    UpdatePercentiles(bundle);
+    bundle.timing = ComputeTiming(bundle.count, bundle.p90Us, bundle.p99Us, bundle.timeoutStreak);
+}
+
+void SelectionInjectTimingController::RecordTimeout(const std::string& bundleName)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    BundleTiming& bundle = GetOrCreateLocked(bundleName);
+    bundle.timeouts++;
+    bundle.timeoutStreak = std::min(bundle.timeoutStreak + 1, INJECT_TIMING_MAX_TIMEOUT_SHIFT);
+    bundle.timing = ComputeTiming(bundle.count, bundle.p90Us, bundle.p99Us, bundle.timeoutStreak);
+    SELECTION_HILOGW("Pasteboard timeout for %{public}s, next wait budget: %{public}uus.", bundleName.c_str(),
+        bundle.timing.waitUs);
+}
+
+std::vector<SelectionBundleTimingStats> SelectionInjectTimingController::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<SelectionBundleTimingStats> stats;
+    stats.reserve(bundles_.size());
+    for (const auto& [bundleName, bundle] : bundles_) {
+        SelectionBundleTimingStats item;
+        item.bundleName = bundleName;
+        item.samples = bundle.count;
+        item.p50Us = bundle.p50Us;
+        item.p90Us = bundle.p90Us;
+        item.p99Us = bundle.p99Us;
+        item.timeoutStreak = bundle.timeoutStreak;
+        item.timeouts = bundle.timeouts;
+        item.timing = bundle.timing;
+        stats.push_back(item);
+    }
+    return stats;
+}
+
+SelectionInjectTiming SelectionInjectTimingController::ComputeTiming(size_t samples, uint32_t p90Us,
+    uint32_t p99Us, uint32_t timeoutStreak)
+{
+    SelectionInjectTiming timing;
+    if (samples >= INJECT_TIMING_MIN_SAMPLES) {
+        timing.holdUs = std::clamp(p90Us + INJECT_HOLD_MARGIN_US, MIN_INJECT_HOLD_US, MAX_INJECT_HOLD_US);
+        uint64_t waitUs = static_cast<uint64_t>(p99Us) * WAIT_SCALE_NUMERATOR / WAIT_SCALE_DENOMINATOR +
+            PASTEBOARD_WAIT_MARGIN_US;
+        timing.waitUs = static_cast<uint32_t>(std::clamp<uint64_t>(waitUs, MIN_PASTEBOARD_WAIT_US,
+            MAX_PASTEBOARD_WAIT_US));
+    }
+    if (timeoutStreak > 0) {
+        // 应用响应变慢时分位数还未反映出来，先按连续超时次数放大等待预算
+        uint64_t waitUs = static_cast<uint64_t>(timing.waitUs) << timeoutStreak;
+        timing.waitUs = static_cast<uint32_t>(std::min<uint64_t>(waitUs, MAX_PASTEBOARD_WAIT_US));
+        timing.holdUs = MAX_INJECT_HOLD_US;
+    }
+    timing.waitUs = std::max(timing.waitUs, timing.holdUs + PASTEBOARD_WAIT_MARGIN_US);
+    return timing;
+}
+
+SelectionInjectTimingController::BundleTiming& SelectionInjectTimingController::GetOrCreateLocked(
+    const std::string& bundleName)
+{
+    auto iter = bundles_.find(bundleName);
+    if (iter == bundles_.end()) {
+        if (bundles_.size() >= MAX_INJECT_TIMING_BUNDLES) {
+            // 淘汰最久未更新的应用
+            auto oldest = std::min_element(bundles_.begin(), bundles_.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.second.lastUpdate < rhs.second.lastUpdate;
+            });
+            bundles_.erase(oldest);
+        }
+        iter = bundles_.emplace(bundleName, BundleTiming()).first;
+    }
+    iter->second.lastUpdate = ++updateCounter_;
+    return iter->second;
+}
+
+void SelectionInjectTimingController::UpdatePercentiles(BundleTiming& bundle)
+{
+    std::vector<uint32_t> sorted(bundle.samples.begin(), bundle.samples.begin() + bundle.count);
+    std::sort(sorted.begin(), sorted.end());
+    bundle.p50Us = Percentile(sorted, PERCENT_50);
+    bundle.p90Us = Percentile(sorted, PERCENT_90);
+    bundle.p99Us = Percentile(sorted, PERCENT_99);
+}
+} // namespace OHOS::SelectionFwk
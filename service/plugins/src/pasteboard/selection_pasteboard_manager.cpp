@@ -16,7 +16,10 @@
 #include "selection_pasteboard_manager.h"
 #include "selection_common.h"
 #include "hisysevent_adapter.h"
-#include <sys/time.h>
+#include <pthread.h>
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
 #include <cstring>
 #include <chrono>
 #include <atomic>
@@ -24,87 +27,79 @@
 #include <future>
 #include <unistd.h>
 #include <sys/ioctl.h>
+#include <sys/uio.h>
 #include <linux/input.h>
 #include <linux/uinput.h>
 #include "selection_log.h"
 #include "selection_errors.h"
+#include "selection_whitespace.h"
+#ifdef SELECTION_ACCESSIBILITY_CONTENT_ENABLE
+#include "selection_accessibility_content_provider.h"
+#endif
  
 namespace OHOS::SelectionFwk {
 
+namespace {
+constexpr uint32_t OBSERVER_RELEASE_TIMEOUT_MS = 1000; // 清理时等待剪贴板释放观察者的上限（毫秒）
+
+std::mutex g_observerMutex;
+std::condition_variable g_observerCv;
+uint32_t g_liveObservers = 0;
+} // namespace
+
 // SelectionPasteboardDisposableObserver implementation
-SelectionPasteboardDisposableObserver::SelectionPasteboardDisposableObserver() = default;
+SelectionPasteboardDisposableObserver::SelectionPasteboardDisposableObserver()
+{
+    std::lock_guard<std::mutex> lock(g_observerMutex);
+    g_liveObservers++;
+}
+
+SelectionPasteboardDisposableObserver::~SelectionPasteboardDisposableObserver()
+{
+    std::lock_guard<std::mutex> lock(g_observerMutex);
+    g_liveObservers--;
+    g_observerCv.notify_all();
+}
+
+bool SelectionPasteboardDisposableObserver::WaitAllReleased(std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(g_observerMutex);
+    return g_observerCv.wait_for(lock, timeout, []() { return g_liveObservers == 0; });
+}
 
 void SelectionPasteboardDisposableObserver::SetBundleName(const std::string& bundleName)
 {
     bundleName_ = bundleName;
 }
 
+void SelectionPasteboardDisposableObserver::SetRequest(uint64_t requestId,
+    const std::weak_ptr<SelectionPasteboardManager>& manager)
+{
+    requestId_ = requestId;
+    manager_ = manager;
+}
+
 // Constants moved from original module
 constexpr const uint32_t MAX_PASTERBOARD_TEXT_LENGTH = 2000;
 constexpr const uint32_t BYTES_PER_CHINESE_CHAR = 3;
-constexpr const uint32_t MAX_DELAY_WAIT_FOR_PB = 110;
 constexpr int32_t PB_ERR_OUT_OF_RANGE = 5;
 constexpr int32_t PB_ERR_CANNOT_GET_CONTENT = 7;
  
-static const unsigned int UTF8_2BYTE_LEN = 2;
-static const unsigned int UTF8_3BYTE_LEN = 3;
-static const unsigned int UTF8_4BYTE_LEN = 4;
- 
 const unsigned int SLEEP_USEC_AFTER_CTRL_DOWN = 1000;
 const unsigned int SLEEP_USEC_AFTER_C_DOWN = 1000;
-const unsigned int SLEEP_USEC_AFTER_C_UP = 60000;
- 
-// Threading
-std::mutex mtx_;
-std::condition_variable cv_;
-std::string g_selectionContent;
-int32_t g_pasteBoardErrorCode;
+constexpr int64_t USEC_PER_MSEC = 1000;
+
+static int64_t GetMonotonicTimeUs()
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::microseconds>(now).count();
+}
  
 // SelectionPasteboardDisposableObserver implementation
  
 bool SelectionPasteboardDisposableObserver::IsAllWhitespace(const std::string &str)
 {
-    static const std::string invisibleChars =
-        " \t\n\r\f\v"
-        "\u00A0\u1680\u180E"
-        "\u2000\u2001\u2002\u2003\u2004\u2005\u2006\u2007\u2008\u2009\u200A"
-        "\u200B\u200C\u200D\u200E\u200F"
-        "\u2028\u2029\u202A\u202B\u202C\u202D\u202E"
-        "\u205F\u2060\u2061\u2062\u2063\u2064"
-        "\u3000\uFEFF";
- 
-    for (size_t i = 0; i < str.size();) {
-        if (static_cast<unsigned char>(str[i]) < 0x80) {
-            if (invisibleChars.find(str[i]) == std::string::npos) {
-                return false;
-            }
-            ++i;
-        } else {
-            uint32_t len = 0;
-            if ((str[i] & 0xE0) == 0xC0) {
-                len = UTF8_2BYTE_LEN;
-            } else if ((str[i] & 0xF0) == 0xE0) {
-                len = UTF8_3BYTE_LEN;
-            } else if ((str[i] & 0xF8) == 0xF0) {
-                len = UTF8_4BYTE_LEN;
-            } else {
-                return false;
-            }
-
-            if (i + len > str.size()) {
-                return false;
-            }
-
-            std::string utf8Char = str.substr(i, len);
-            if (invisibleChars.find(utf8Char) == std::string::npos) {
-                return false;
-            }
-
-            i += len;
-        }
-    }
- 
-    return true;
+    return IsAllInvisibleText(str);
 }
  
 void SelectionPasteboardDisposableObserver::OnTextReceived(const std::string &text, int32_t errCode)
@@ -120,22 +115,159 @@ void SelectionPasteboardDisposableObserver::OnTextReceived(const std::string &te
     if (IsAllWhitespace(text)) {
         SELECTION_HILOGI("Received empty text or all whitespaces.");
     }
-    SELECTION_HILOGI("Notify SelectionPasteboardManager return text");
-    std::lock_guard<std::mutex> lock(mtx_);
-    g_selectionContent = text;
-    g_pasteBoardErrorCode = errCode;
-    cv_.notify_one();
+    auto manager = manager_.lock();
+    if (manager == nullptr) {
+        SELECTION_HILOGW("SelectionPasteboardManager is released, drop text of request %{public}" PRIu64 ".",
+            requestId_);
+        return;
+    }
+    SELECTION_HILOGI("Notify SelectionPasteboardManager return text, request: %{public}" PRIu64 ".", requestId_);
+    manager->OnTextReceived(requestId_, text, errCode);
+}
+
+// SelectionPasteboardRequest implementation
+SelectionPasteboardRequest::SelectionPasteboardRequest(uint64_t id) : id_(id), future_(promise_.get_future().share())
+{
+}
+
+uint64_t SelectionPasteboardRequest::GetId() const
+{
+    return id_;
+}
+
+bool SelectionPasteboardRequest::Complete(SelectionPasteboardResult result)
+{
+    if (completed_.exchange(true)) {
+        return false;
+    }
+    promise_.set_value(std::move(result));
+    {
+        // 经过一次加锁再唤醒，避免等待方检查完状态、尚未睡眠时错过通知
+        std::lock_guard<std::mutex> lock(stateMutex_);
+    }
+    stateCv_.notify_all();
+    return true;
+}
+
+bool SelectionPasteboardRequest::WaitFor(std::chrono::microseconds timeout) const
+{
+    return future_.wait_for(timeout) == std::future_status::ready;
+}
+
+bool SelectionPasteboardRequest::WaitForResponse(std::chrono::microseconds queueTimeout,
+    std::chrono::microseconds waitTimeout) const
+{
+    {
+        std::unique_lock<std::mutex> lock(stateMutex_);
+        if (!stateCv_.wait_for(lock, queueTimeout,
+            [this]() { return injectTimeUs_.load() != 0 || completed_.load(); })) {
+            return false;
+        }
+    }
+    int64_t injectTimeUs = injectTimeUs_.load();
+    if (injectTimeUs == 0) {
+        // 未注入即已完成（取消或注入失败），结果随即可取
+        future_.wait();
+        return true;
+    }
+    int64_t remainUs = injectTimeUs + waitTimeout.count() - GetMonotonicTimeUs();
+    return future_.wait_for(std::chrono::microseconds(std::max<int64_t>(remainUs, 0))) ==
+        std::future_status::ready;
+}
+
+SelectionPasteboardResult SelectionPasteboardRequest::GetResult() const
+{
+    return future_.get();
+}
+
+void SelectionPasteboardRequest::MarkInjected(int64_t timeUs)
+{
+    {
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        injectTimeUs_.store(timeUs);
+    }
+    stateCv_.notify_all();
+}
+
+int64_t SelectionPasteboardRequest::GetInjectTimeUs() const
+{
+    return injectTimeUs_.load();
+}
+
+// SelectionInjectLatencyHistogram implementation
+void SelectionInjectLatencyHistogram::Record(int64_t costUs)
+{
+    uint64_t cost = costUs > 0 ? static_cast<uint64_t>(costUs) : 0;
+    size_t index = 0;
+    while (index < INJECT_LATENCY_BUCKET_BOUNDS_MS.size() &&
+        cost > static_cast<uint64_t>(INJECT_LATENCY_BUCKET_BOUNDS_MS[index] * USEC_PER_MSEC)) {
+        index++;
+    }
+    buckets_[index].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    totalUs_.fetch_add(cost, std::memory_order_relaxed);
+    uint64_t maxUs = maxUs_.load(std::memory_order_relaxed);
+    while (cost > maxUs && !maxUs_.compare_exchange_weak(maxUs, cost, std::memory_order_relaxed)) {
+    }
+}
+
+std::array<uint64_t, INJECT_LATENCY_BUCKET_COUNT> SelectionInjectLatencyHistogram::GetBuckets() const
+{
+    std::array<uint64_t, INJECT_LATENCY_BUCKET_COUNT> buckets {};
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+    }
+    return buckets;
+}
+
+uint64_t SelectionInjectLatencyHistogram::GetCount() const
+{
+    return count_.load(std::memory_order_relaxed);
+}
+
+uint64_t SelectionInjectLatencyHistogram::GetTotalUs() const
+{
+    return totalUs_.load(std::memory_order_relaxed);
+}
+
+uint64_t SelectionInjectLatencyHistogram::GetMaxUs() const
+{
+    return maxUs_.load(std::memory_order_relaxed);
 }
  
+// SelectionSyntheticCopyProvider implementation
+SelectionSyntheticCopyProvider::SelectionSyntheticCopyProvider(
+    const std::weak_ptr<SelectionPasteboardManager>& manager) : manager_(manager)
+{
+}
+
+const char *SelectionSyntheticCopyProvider::GetName() const
+{
+    return "synthetic_copy";
+}
+
+bool SelectionSyntheticCopyProvider::IsAvailable(const SelectionContentQuery& query) const
+{
+    return !manager_.expired();
+}
+
+int32_t SelectionSyntheticCopyProvider::GetContent(const SelectionContentQuery& query, std::string& content)
+{
+    auto manager = manager_.lock();
+    if (manager == nullptr) {
+        return SelectionServiceError::INVALID_DATA;
+    }
+    return manager->GetContentBySyntheticCopy(query, content);
+}
+
 // SelectionPasteboardManager implementation
 SelectionPasteboardManager::SelectionPasteboardManager()
-    : initialized_(false), fd_(-1), canGetSelectionContentFlag_(false), injectFailed_(false), injectCtrlCRunning_(false)
+    : initialized_(false), fd_(-1), canGetSelectionContentFlag_(false), nextRequestId_(1)
 {
 }
  
 SelectionPasteboardManager::~SelectionPasteboardManager()
 {
-    WaitForPendingAsync();
     Cleanup();
 }
  
@@ -146,13 +278,19 @@ bool SelectionPasteboardManager::Initialize()
         return true;
     }
     self_weak_ = shared_from_this(); // 确保对象已构造完成
-    pasteboardObserver_ = sptr<SelectionPasteboardDisposableObserver>::MakeSptr();
  
     // Initialize virtual keyboard device (moved from original InitUidev)
     if (!InitUidev()) {
         SELECTION_HILOGE("Failed to initialize uidev");
         return false;
     }
+    StartInjectWorker();
+    providerChain_.Register(std::make_shared<SelectionSyntheticCopyProvider>(self_weak_),
+        SYNTHETIC_COPY_CONTENT_PROVIDER_PRIORITY);
+#ifdef SELECTION_ACCESSIBILITY_CONTENT_ENABLE
+    providerChain_.Register(std::make_shared<SelectionAccessibilityContentProvider>(),
+        ACCESSIBILITY_CONTENT_PROVIDER_PRIORITY);
+#endif
  
     initialized_ = true;
     return true;
@@ -170,6 +308,14 @@ void SelectionPasteboardManager::SetCanGetSelectionContentFlag(bool flag)
  
 void SelectionPasteboardManager::Cleanup()
 {
+    // 先停止注入线程，再关闭它使用的 uinput fd
+    StopInjectWorker();
+    // 结束仍在等待的请求，再等剪贴板释放已订阅的观察者，迟到的回调不能在插件卸载后进入插件代码
+    CancelPendingRequests();
+    if (!SelectionPasteboardDisposableObserver::WaitAllReleased(
+        std::chrono::milliseconds(OBSERVER_RELEASE_TIMEOUT_MS))) {
+        SELECTION_HILOGW("Pasteboard observers are not released in %{public}ums.", OBSERVER_RELEASE_TIMEOUT_MS);
+    }
     if (fd_ == -1) {
         return;
     }
@@ -234,47 +380,50 @@ CLEAN:
     return false;
 }
  
-int32_t SelectionPasteboardManager::InjectCtrlC() const
+int32_t SelectionPasteboardManager::InjectCtrlC(uint32_t holdUs) const
 {
     SELECTION_HILOGI("InjectCtrlC to /dev/uinput using fd %{public}d.", fd_);
     if (fd_ == -1) {
         SELECTION_HILOGE("fd of /dev/uinput is invalid, skip injecting ctrl c.");
         return SelectionServiceError::INVALID_DATA;
     }
- 
-    struct input_event ev;
-    auto sendEvent = [&](int type, int code, int value) {
-        memset_s(&ev, sizeof(ev), 0, sizeof(ev));
-        struct timeval time{};
-        gettimeofday(&time, NULL);
-        ev.input_event_sec = time.tv_sec;
-        ev.input_event_usec = time.tv_usec;
-        ev.type = type;
-        ev.code = code;
-        ev.value = value;
-        if (write(fd_, &ev, sizeof(ev)) < 0) {
-            SELECTION_HILOGE("Failed to send event {type=%{public}d, code=%{public}d, value=%{public}d}",
-                type, code, value);
+
+    // 每次按键变化与随后的 SYN_REPORT 通过一次 writev 写入；
+    // uinput 会忽略写入事件中的时间戳，由内核在注入时打点，因此无需逐个事件获取时间
+    bool success = true;
+    auto sendKey = [this, &success](int code, int value) {
+        struct input_event events[2];
+        memset_s(events, sizeof(events), 0, sizeof(events));
+        events[0].type = EV_KEY;
+        events[0].code = code;
+        events[0].value = value;
+        events[1].type = EV_SYN;
+        events[1].code = SYN_REPORT;
+        struct iovec iov[2] = {
+            { &events[0], sizeof(events[0]) },
+            { &events[1], sizeof(events[1]) },
+        };
+        if (writev(fd_, iov, 2) != static_cast<ssize_t>(sizeof(events))) {
+            SELECTION_HILOGE("Failed to send key event {code=%{public}d, value=%{public}d}", code, value);
+            success = false;
         }
     };
- 
-    sendEvent(EV_KEY, KEY_LEFTCTRL, 1);
-    sendEvent(EV_SYN, SYN_REPORT, 0);
+
+    sendKey(KEY_LEFTCTRL, 1);
     usleep(SLEEP_USEC_AFTER_CTRL_DOWN);
- 
-    sendEvent(EV_KEY, KEY_C, 1);
-    sendEvent(EV_SYN, SYN_REPORT, 0);
+
+    sendKey(KEY_C, 1);
     usleep(SLEEP_USEC_AFTER_C_DOWN);
- 
-    sendEvent(EV_KEY, KEY_C, 0);
-    sendEvent(EV_SYN, SYN_REPORT, 0);
-    usleep(SLEEP_USEC_AFTER_C_UP);
- 
-    sendEvent(EV_KEY, KEY_LEFTCTRL, 0);
-    sendEvent(EV_SYN, SYN_REPORT, 0);
- 
+
+    sendKey(KEY_C, 0);
+    // 保持 Ctrl 的时长按目标应用的历史响应时间调整
+    usleep(std::min(holdUs, MAX_INJECT_HOLD_US));
+
+    // 即使前面的写入失败也要尝试抬起 Ctrl，避免按键状态残留
+    sendKey(KEY_LEFTCTRL, 0);
+
     SELECTION_HILOGI("End up InjectCtrlC to /dev/uinput.");
-    return ERR_OK;
+    return success ? ERR_OK : SelectionServiceError::INVALID_DATA;
 }
  
 int32_t SelectionPasteboardManager::PasteBoardErrorCodeToSelectionService(int32_t pasteBoardErrCode)
@@ -300,81 +449,272 @@ int32_t SelectionPasteboardManager::PasteBoardErrorCodeToSelectionService(int32_
     return ret;
 }
 
-void SelectionPasteboardManager::WaitForPendingAsync()
+void SelectionPasteboardManager::StartInjectWorker()
+{
+    if (injectRunning_.exchange(true)) {
+        return;
+    }
+    injectWorker_ = std::thread([this]() { RunInjectWorker(); });
+}
+
+void SelectionPasteboardManager::StopInjectWorker()
+{
+    if (!injectRunning_.exchange(false)) {
+        return;
+    }
+    // 已通过运行状态检查的生产者仍可能在入队，等其完成后停止后不会再有请求进入队列
+    while (injectProducers_.load() != 0) {
+        std::this_thread::yield();
+    }
+    {
+        std::lock_guard<std::mutex> lock(injectWaitMutex_);
+        injectCv_.notify_all();
+    }
+    if (injectWorker_.joinable()) {
+        injectWorker_.join();
+    }
+    // 线程退出后队列中剩余的请求不会再被注入，直接以失败结束，避免调用方空等到超时
+    SelectionInjectTask task;
+    while (injectQueue_.TryPop(task)) {
+        auto request = FindRequest(task.requestId);
+        if (request != nullptr) {
+            SelectionPasteboardResult failed;
+            failed.errCode = SelectionServiceError::INVALID_DATA;
+            failed.injectFailed = true;
+            request->Complete(std::move(failed));
+        }
+    }
+    SELECTION_HILOGI("Inject worker stopped.");
+}
+
+void SelectionPasteboardManager::RunInjectWorker()
+{
+    pthread_setname_np(pthread_self(), "OS_SelectionInj");
+    SelectionInjectTask task;
+    while (injectRunning_.load()) {
+        if (!injectQueue_.TryPop(task)) {
+            std::unique_lock<std::mutex> lock(injectWaitMutex_);
+            injectWaiting_.store(true);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            injectCv_.wait(lock, [this]() { return !injectRunning_.load() || !injectQueue_.Empty(); });
+            injectWaiting_.store(false);
+            continue;
+        }
+        InjectForRequest(task);
+    }
+}
+
+bool SelectionPasteboardManager::PostInjectTask(uint64_t requestId, uint32_t holdUs)
+{
+    SelectionInjectTask task;
+    task.requestId = requestId;
+    task.holdUs = holdUs;
+    task.enqueueTimeUs = GetMonotonicTimeUs();
+    // 先登记生产者再检查运行状态，与 StopInjectWorker 中先置停止再等待生产者的顺序配对
+    injectProducers_.fetch_add(1);
+    bool pushed = injectRunning_.load() && injectQueue_.TryPush(task);
+    injectProducers_.fetch_sub(1);
+    if (!pushed) {
+        injectDropped_.fetch_add(1, std::memory_order_relaxed);
+        SELECTION_HILOGE("Inject queue is unavailable, drop request %{public}" PRIu64 ".", requestId);
+        return false;
+    }
+    // 只有注入线程已进入等待时才需要加锁唤醒
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (injectWaiting_.load()) {
+        std::lock_guard<std::mutex> lock(injectWaitMutex_);
+        injectCv_.notify_one();
+    }
+    return true;
+}
+
+void SelectionPasteboardManager::InjectForRequest(const SelectionInjectTask& task)
+{
+    auto request = FindRequest(task.requestId);
+    if (request == nullptr) {
+        // 请求已超时结束，不再向前台应用注入按键
+        injectSkipped_.fetch_add(1, std::memory_order_relaxed);
+        SELECTION_HILOGW("Request %{public}" PRIu64 " is finished before inject, waited %{public}" PRId64 "us.",
+            task.requestId, GetMonotonicTimeUs() - task.enqueueTimeUs);
+        return;
+    }
+    request->MarkInjected(GetMonotonicTimeUs());
+    injectCount_.fetch_add(1, std::memory_order_relaxed);
+    int32_t result = InjectCtrlC(task.holdUs);
+    if (result != ERR_OK) {
+        injectFailed_.fetch_add(1, std::memory_order_relaxed);
+        SelectionPasteboardResult failed;
+        failed.errCode = result;
+        failed.injectFailed = true;
+        request->Complete(std::move(failed));
+    }
+}
+
+std::shared_ptr<SelectionPasteboardRequest> SelectionPasteboardManager::CreateRequest()
+{
+    auto request = std::make_shared<SelectionPasteboardRequest>(nextRequestId_.fetch_add(1));
+    std::lock_guard<std::mutex> lock(requestsMutex_);
+    pendingRequests_[request->GetId()] = request;
+    return request;
+}
+
+std::shared_ptr<SelectionPasteboardRequest> SelectionPasteboardManager::FindRequest(uint64_t requestId)
+{
+    std::lock_guard<std::mutex> lock(requestsMutex_);
+    auto iter = pendingRequests_.find(requestId);
+    return iter == pendingRequests_.end() ? nullptr : iter->second;
+}
+
+void SelectionPasteboardManager::CancelPendingRequests()
+{
+    std::map<uint64_t, std::shared_ptr<SelectionPasteboardRequest>> requests;
+    {
+        std::lock_guard<std::mutex> lock(requestsMutex_);
+        requests.swap(pendingRequests_);
+    }
+    for (auto& entry : requests) {
+        SelectionPasteboardResult cancelled;
+        cancelled.errCode = SelectionServiceError::INVALID_DATA;
+        cancelled.cancelled = true;
+        entry.second->Complete(std::move(cancelled));
+    }
+}
+
+void SelectionPasteboardManager::RemoveRequest(uint64_t requestId)
 {
-    if (injectCtrlCFuture_.valid()) {
-        SELECTION_HILOGI("Waiting for pending async InjectCtrlC to complete.");
-        injectCtrlCFuture_.wait();
-        injectCtrlCRunning_.store(false);
+    std::lock_guard<std::mutex> lock(requestsMutex_);
+    pendingRequests_.erase(requestId);
+}
+
+void SelectionPasteboardManager::OnTextReceived(uint64_t requestId, const std::string& text, int32_t errCode)
+{
+    auto request = FindRequest(requestId);
+    if (request == nullptr) {
+        SELECTION_HILOGW("Request %{public}" PRIu64 " is finished, drop late pasteboard text.", requestId);
+        return;
+    }
+    SelectionPasteboardResult result;
+    int64_t injectTimeUs = request->GetInjectTimeUs();
+    if (injectTimeUs > 0) {
+        result.latencyUs = GetMonotonicTimeUs() - injectTimeUs;
+        injectLatency_.Record(result.latencyUs);
+    }
+    result.errCode = errCode;
+    result.text = text;
+    request->Complete(std::move(result));
+}
+
+void SelectionPasteboardManager::RegisterContentProvider(const std::shared_ptr<SelectionContentProvider>& provider,
+    int32_t priority)
+{
+    providerChain_.Register(provider, priority);
+}
+
+void SelectionPasteboardManager::DumpStats(int32_t fd) const
+{
+    uint64_t count = injectLatency_.GetCount();
+    dprintf(fd, "pasteboard.inject: injected=%" PRIu64 " failed=%" PRIu64 " dropped=%" PRIu64 " skipped=%" PRIu64
+        " depth=%zu\n", injectCount_.load(), injectFailed_.load(), injectDropped_.load(), injectSkipped_.load(),
+        injectQueue_.Size());
+    dprintf(fd, "pasteboard.inject.latency: count=%" PRIu64 " avgUs=%" PRIu64 " maxUs=%" PRIu64 "\n", count,
+        count == 0 ? 0 : injectLatency_.GetTotalUs() / count, injectLatency_.GetMaxUs());
+    auto buckets = injectLatency_.GetBuckets();
+    std::string histogram;
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        if (i < INJECT_LATENCY_BUCKET_BOUNDS_MS.size()) {
+            histogram += " <=" + std::to_string(INJECT_LATENCY_BUCKET_BOUNDS_MS[i]) + "ms:";
+        } else {
+            histogram += " >" + std::to_string(INJECT_LATENCY_BUCKET_BOUNDS_MS.back()) + "ms:";
+        }
+        histogram += std::to_string(buckets[i]);
+    }
+    dprintf(fd, "pasteboard.inject.histogram:%s\n", histogram.c_str());
+    for (const auto& stats : injectTiming_.GetStats()) {
+        dprintf(fd, "pasteboard.timing[%s]: samples=%zu p50Us=%u p90Us=%u p99Us=%u holdUs=%u waitUs=%u"
+            " timeouts=%" PRIu64 "\n", stats.bundleName.c_str(), stats.samples, stats.p50Us, stats.p90Us,
+            stats.p99Us, stats.timing.holdUs, stats.timing.waitUs, stats.timeouts);
     }
+    providerChain_.Dump(fd);
 }
 
 int32_t SelectionPasteboardManager::GetSelectionContent(std::string& selectionContent, uint32_t windowId,
-    const std::string& bundleName)
+    const std::string& bundleName, uint32_t maxLength, const SelectionPluginPoint* point)
 {
     SELECTION_HILOGI("SelectionPasteboardManager::GetSelectionContent start");
     if (!initialized_) {
         SELECTION_HILOGE("SelectionPasteboardManager not initialized is nullptr");
         return SelectionServiceError::INVALID_DATA;
     }
-    // 在开始新的异步注入之前，确保之前的异步注入已完成
-    WaitForPendingAsync();
-    pasteboardObserver_->SetBundleName(bundleName);
-    int32_t ret = PasteboardClient::GetInstance()->SubscribeDisposableObserver(pasteboardObserver_,
-        windowId, DisposableType::PLAIN_TEXT, MAX_PASTERBOARD_TEXT_LENGTH * BYTES_PER_CHINESE_CHAR);
+    SelectionContentQuery query;
+    query.windowId = windowId;
+    query.bundleName = bundleName;
+    query.maxLength = maxLength == 0 ? MAX_PASTERBOARD_TEXT_LENGTH * BYTES_PER_CHINESE_CHAR : maxLength;
+    if (point != nullptr) {
+        query.hasPoint = true;
+        query.displayX = point->displayX;
+        query.displayY = point->displayY;
+    }
+    return providerChain_.GetContent(query, selectionContent);
+}
+
+int32_t SelectionPasteboardManager::GetContentBySyntheticCopy(const SelectionContentQuery& query,
+    std::string& selectionContent)
+{
+    uint32_t windowId = query.windowId;
+    const std::string& bundleName = query.bundleName;
+    // 每个请求有独立的完成槽位，前一个请求的迟到回调不会影响本次结果
+    auto request = CreateRequest();
+    uint64_t requestId = request->GetId();
+    auto observer = sptr<SelectionPasteboardDisposableObserver>::MakeSptr();
+    observer->SetBundleName(bundleName);
+    observer->SetRequest(requestId, self_weak_);
+    int32_t ret = PasteboardClient::GetInstance()->SubscribeDisposableObserver(observer,
+        windowId, DisposableType::PLAIN_TEXT, query.maxLength);
     if (ret != ERR_OK) {
         SELECTION_HILOGE("Failed to SubscribeDisposableObserver, ret: %{public}d.", ret);
+        RemoveRequest(requestId);
         return SelectionServiceError::INVALID_DATA;
     }
-    // ---- 异步注入CtrlC ----
-    injectFailed_.store(false);
-    injectCtrlCRunning_.store(true);
-    injectCtrlCFuture_ = std::async(std::launch::async, [self_weak = self_weak_]() -> int32_t {
-        auto self = self_weak.lock(); // 尝试获取 shared_ptr
-        if (!self) {
-            return SelectionServiceError::INVALID_DATA; // 对象已销毁
-        }
-        int32_t result = self->InjectCtrlC();
-        if (result != ERR_OK) {
-            self->injectFailed_.store(true);
-            cv_.notify_one();
-        }
-        self->injectCtrlCRunning_.store(false);
-        return result;
-    });
- 
-    std::unique_lock<std::mutex> lock(mtx_);
-    SELECTION_HILOGI("Start wait for pasteboard OnTextReceived (async InjectCtrlC)");
-    bool received = cv_.wait_for(lock, std::chrono::milliseconds(MAX_DELAY_WAIT_FOR_PB),
-        [this] {
-            return !g_selectionContent.empty() || injectFailed_.load();
-        });
-    if (received && !g_selectionContent.empty()) {
-        selectionContent = g_selectionContent;
-        g_selectionContent = "";
-        ret = ERR_OK;
-        SELECTION_HILOGI("receive text success");
-    } else {
-        // 超时或注入失败
-        if (injectFailed_.load()) {
-            // 注入CtrlC失败—从未来获取错误代码
-            int32_t injectResult = SelectionServiceError::INVALID_DATA;
-            if (injectCtrlCFuture_.valid()) {
-                injectResult = injectCtrlCFuture_.get();
-            }
-            HisyseventAdapter::GetInstance()->ReportShowPanelFailed(
-                bundleName, injectResult,
-                static_cast<int32_t>(SelectFailedReason::INJECT_CTRLC_FAILED));
-            SELECTION_HILOGE("Async InjectCtrlC failed: %{public}d", injectResult);
-            ret = SelectionServiceError::INVALID_DATA;
-        } else {
-            // 等待剪贴板回调超时
-            SELECTION_HILOGE("GetSelectionContent: receive content from pasteboard failed (timeout)");
-            ret = PasteBoardErrorCodeToSelectionService(g_pasteBoardErrorCode);
-        }
-        g_pasteBoardErrorCode = ERR_OK;
+    // ---- 交给常驻注入线程注入CtrlC，保持与等待时长按应用的历史响应时间确定 ----
+    SelectionInjectTiming timing = injectTiming_.GetTiming(bundleName);
+    if (!PostInjectTask(requestId, timing.holdUs)) {
+        RemoveRequest(requestId);
+        return SelectionServiceError::INVALID_DATA;
     }
-    return ret;
+
+    SELECTION_HILOGI("Start wait for pasteboard OnTextReceived, request: %{public}" PRIu64 ", holdUs: %{public}u,"
+        " waitUs: %{public}u", requestId, timing.holdUs, timing.waitUs);
+    bool completed = request->WaitForResponse(std::chrono::microseconds(INJECT_QUEUE_TIMEOUT_US),
+        std::chrono::microseconds(timing.waitUs));
+    RemoveRequest(requestId);
+    if (!completed) {
+        // 等待剪贴板回调超时
+        injectTiming_.RecordTimeout(bundleName);
+        SELECTION_HILOGE("GetSelectionContent: receive content from pasteboard failed (timeout)");
+        return PasteBoardErrorCodeToSelectionService(ERR_OK);
+    }
+    SelectionPasteboardResult result = request->GetResult();
+    if (result.cancelled) {
+        SELECTION_HILOGW("Request %{public}" PRIu64 " is cancelled by cleanup.", requestId);
+        return SelectionServiceError::INVALID_DATA;
+    }
+    if (result.injectFailed) {
+        HisyseventAdapter::GetInstance()->ReportShowPanelFailed(
+            bundleName, result.errCode,
+            static_cast<int32_t>(SelectFailedReason::INJECT_CTRLC_FAILED));
+        SELECTION_HILOGE("Async InjectCtrlC failed: %{public}d", result.errCode);
+        return SelectionServiceError::INVALID_DATA;
+    }
+    if (result.text.empty()) {
+        SELECTION_HILOGE("GetSelectionContent: receive content from pasteboard failed");
+        return PasteBoardErrorCodeToSelectionService(result.errCode);
+    }
+    if (result.latencyUs >= 0) {
+        injectTiming_.RecordResponse(bundleName, result.latencyUs);
+    }
+    selectionContent = std::move(result.text);
+    SELECTION_HILOGI("receive text success");
+    return ERR_OK;
 }
 
 }
\ No newline at end of file
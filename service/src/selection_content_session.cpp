@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "selection_content_session.h"
+
+#include <algorithm>
+#include <unistd.h>
+#include "selection_content_shm.h"
+#include "selection_errors.h"
+#include "selection_log.h"
+
+namespace OHOS::SelectionFwk {
+namespace {
+constexpr uint8_t UTF8_CONTINUATION_MASK = 0xC0;
+constexpr uint8_t UTF8_CONTINUATION_BYTE = 0x80;
+
+bool IsUtf8Continuation(char ch)
+{
+    return (static_cast<uint8_t>(ch) & UTF8_CONTINUATION_MASK) == UTF8_CONTINUATION_BYTE;
+}
+} // namespace
+
+SelectionContentSession::~SelectionContentSession()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    Reset();
+}
+
+int32_t SelectionContentSession::Open(int32_t fd, int32_t pid, uint32_t& length)
+{
+    length = 0;
+    if (fd < 0) {
+        return SelectionServiceError::INVALID_DATA;
+    }
+    int32_t size = AshmemGetSize(fd);
+    if (size < static_cast<int32_t>(sizeof(SelectionContentShmHeader))) {
+        SELECTION_HILOGE("Invalid selection content shared memory size: %{public}d", size);
+        close(fd);
+        return SelectionServiceError::INVALID_DATA;
+    }
+    sptr<Ashmem> ashmem = new (std::nothrow) Ashmem(fd, size);
+    if (ashmem == nullptr) {
+        close(fd);
+        return SelectionServiceError::INVALID_DATA;
+    }
+    if (!ashmem->MapReadOnlyAshmem()) {
+        ashmem->CloseAshmem();
+        return SelectionServiceError::INVALID_DATA;
+    }
+    const auto *header = static_cast<const SelectionContentShmHeader *>(
+        ashmem->ReadFromAshmem(sizeof(SelectionContentShmHeader), 0));
+    if (header == nullptr || header->magic != SELECTION_CONTENT_SHM_MAGIC ||
+        header->length > static_cast<uint32_t>(size) - sizeof(SelectionContentShmHeader)) {
+        SELECTION_HILOGE("Invalid selection content shared memory header");
+        ashmem->UnmapAshmem();
+        ashmem->CloseAshmem();
+        return SelectionServiceError::INVALID_DATA;
+    }
+    uint32_t contentLength = header->length;
+    const char *content = contentLength == 0 ? nullptr : static_cast<const char *>(
+        ashmem->ReadFromAshmem(contentLength, sizeof(SelectionContentShmHeader)));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    Reset();
+    ashmem_ = ashmem;
+    content_ = content;
+    length_ = contentLength;
+    pid_ = pid;
+    length = contentLength;
+    SELECTION_HILOGI("Open selection content session, pid: %{public}d, length: %{public}u", pid, contentLength);
+    return 0;
+}
+
+int32_t SelectionContentSession::Read(int32_t pid, uint32_t offset, uint32_t maxLength, std::string& chunk)
+{
+    chunk.clear();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (ashmem_ == nullptr || pid != pid_) {
+        SELECTION_HILOGE("Selection content session is not opened by pid: %{public}d", pid);
+        return SelectionServiceError::INVALID_TIMING;
+    }
+    if (offset > length_) {
+        return SelectionServiceError::CONTENT_OUT_OF_RANGE;
+    }
+    if (offset == length_) {
+        return 0;
+    }
+    if (IsUtf8Continuation(content_[offset])) {
+        SELECTION_HILOGE("Chunk offset %{public}u is not on a UTF-8 boundary", offset);
+        return SelectionServiceError::INVALID_DATA;
+    }
+    maxLength = std::min(maxLength, MAX_SELECTION_CONTENT_CHUNK_SIZE);
+    uint32_t chunkLength = Utf8ChunkLength(content_ + offset, length_ - offset, maxLength);
+    if (chunkLength == 0) {
+        return SelectionServiceError::INVALID_DATA;
+    }
+    chunk.assign(content_ + offset, chunkLength);
+    return 0;
+}
+
+void SelectionContentSession::Close(int32_t pid)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (pid != -1 && pid != pid_) {
+        return;
+    }
+    Reset();
+}
+
+bool SelectionContentSession::IsOpen() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return ashmem_ != nullptr;
+}
+
+uint32_t SelectionContentSession::Utf8ChunkLength(const char *data, uint32_t remaining, uint32_t maxLength)
+{
+    if (data == nullptr) {
+        return 0;
+    }
+    if (remaining <= maxLength) {
+        return remaining;
+    }
+    // data[length] 是下一块的首字节，不能是多字节字符的后续字节
+    uint32_t length = maxLength;
+    while (length > 0 && IsUtf8Continuation(data[length])) {
+        length--;
+    }
+    return length;
+}
+
+void SelectionContentSession::Reset()
+{
+    if (ashmem_ != nullptr) {
+        ashmem_->UnmapAshmem();
+        ashmem_->CloseAshmem();
+        ashmem_ = nullptr;
+    }
+    content_ = nullptr;
+    length_ = 0;
+    pid_ = -1;
+}
+} // namespace OHOS::SelectionFwk
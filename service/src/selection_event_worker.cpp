@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "selection_event_worker.h"
+
+#include <chrono>
+#include <pthread.h>
+#include "selection_log.h"
+
+namespace OHOS::SelectionFwk {
+SelectionEventWorker::~SelectionEventWorker()
+{
+    Stop();
+}
+
+void SelectionEventWorker::Start(const EventHandler& handler)
+{
+    if (running_.exchange(true)) {
+        SELECTION_HILOGW("selection event worker is already running");
+        return;
+    }
+    handler_ = handler;
+    worker_ = std::thread([this]() { Run(); });
+}
+
+void SelectionEventWorker::Stop()
+{
+    if (!running_.exchange(false)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cv_.notify_all();
+    }
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    SELECTION_HILOGI("selection event worker stopped");
+}
+
+bool SelectionEventWorker::Post(SelectionEventRecord& record)
+{
+    record.enqueueTimeUs = GetMonotonicTimeUs();
+    if (!queue_.TryPush(record)) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        SELECTION_HILOGE("selection event queue is full, drop event %{public}u", record.seqId);
+        return false;
+    }
+    size_t depth = queue_.Size();
+    size_t maxDepth = maxQueueDepth_.load(std::memory_order_relaxed);
+    while (depth > maxDepth && !maxQueueDepth_.compare_exchange_weak(maxDepth, depth, std::memory_order_relaxed)) {
+    }
+    // 只有消费者已进入等待时才需要加锁唤醒，正常投递路径无锁
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiting_.load()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cv_.notify_one();
+    }
+    return true;
+}
+
+void SelectionEventWorker::Run()
+{
+    pthread_setname_np(pthread_self(), "OS_SelectionEvt");
+    SelectionEventRecord record;
+    while (running_.load()) {
+        if (!queue_.TryPop(record)) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            waiting_.store(true);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            cv_.wait(lock, [this]() { return !running_.load() || !queue_.Empty(); });
+            waiting_.store(false);
+            continue;
+        }
+        RecordStage(SelectionStage::QUEUE_WAIT, GetMonotonicTimeUs() - record.enqueueTimeUs);
+        if (handler_ != nullptr) {
+            handler_(record);
+        }
+    }
+}
+
+void SelectionEventWorker::RecordStage(SelectionStage stage, int64_t costUs)
+{
+    auto index = static_cast<size_t>(stage);
+    if (index >= stages_.size()) {
+        return;
+    }
+    uint64_t cost = costUs > 0 ? static_cast<uint64_t>(costUs) : 0;
+    StageCounter& counter = stages_[index];
+    counter.count.fetch_add(1, std::memory_order_relaxed);
+    counter.totalUs.fetch_add(cost, std::memory_order_relaxed);
+    uint64_t maxUs = counter.maxUs.load(std::memory_order_relaxed);
+    while (cost > maxUs && !counter.maxUs.compare_exchange_weak(maxUs, cost, std::memory_order_relaxed)) {
+    }
+}
+
+SelectionWorkerStats SelectionEventWorker::GetStats() const
+{
+    SelectionWorkerStats stats;
+    stats.queueDepth = queue_.Size();
+    stats.maxQueueDepth = maxQueueDepth_.load(std::memory_order_relaxed);
+    stats.dropped = dropped_.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < stages_.size(); ++i) {
+        stats.stages[i].count = stages_[i].count.load(std::memory_order_relaxed);
+        stats.stages[i].totalUs = stages_[i].totalUs.load(std::memory_order_relaxed);
+        stats.stages[i].maxUs = stages_[i].maxUs.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+int64_t SelectionEventWorker::GetMonotonicTimeUs()
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::microseconds>(now).count();
+}
+} // namespace OHOS::SelectionFwk
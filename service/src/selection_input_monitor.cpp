@@ -13,11 +13,15 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <condition_variable>
 #include <mutex>
+#include <pthread.h>
+#include <thread>
 #include <input_manager.h>
 #include "selection_service.h"
 #include "selection_common.h"
+#include "selection_content_shm.h"
 #include "selection_log.h"
 #include "common_event_manager.h"
 #include "selection_config.h"
@@ -25,6 +29,7 @@
 #include "selection_errors.h"
 #include "hisysevent_adapter.h"
 #include "selection_timer.h"
+#include "focus_monitor_manager.h"
 #ifdef SCENE_BOARD_ENABLE
 #include "window_manager_lite.h"
 #else
@@ -40,9 +45,9 @@ using namespace OHOS::EventFwk;
 std::atomic<uint32_t> selSeqId = 0;
 const std::unordered_set<std::string> appBlocklist = {};
 
-static int64_t GetCurrentTimeMillis()
+static int64_t GetMonotonicTimeMillis()
 {
-    auto now = std::chrono::system_clock::now();
+    auto now = std::chrono::steady_clock::now();
     auto duration = now.time_since_epoch();
     return std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
 }
@@ -52,6 +57,11 @@ uint32_t GenerateSequenceId()
     return selSeqId.fetch_add(1, std::memory_order_seq_cst);
 }
 
+static SelectionPluginPoint GetSelectionStartPoint(const SelectionInfo& selectionInfo)
+{
+    return SelectionPluginPoint { selectionInfo.startDisplayX, selectionInfo.startDisplayY };
+}
+
 bool BaseSelectionInputMonitor::IsSelectionTriggered() const
 {
     return IsSelectionDone();
@@ -59,206 +69,311 @@ bool BaseSelectionInputMonitor::IsSelectionTriggered() const
 
 const SelectionInfo& BaseSelectionInputMonitor::GetSelectionInfo() const
 {
-    return selectionInfo_;
+    return ActiveSlot().selectionInfo;
 }
 
 void BaseSelectionInputMonitor::OnInputEvent(std::shared_ptr<KeyEvent> keyEvent) const
 {
     SELECTION_HILOGD("Before keyEvent, curSelectState: %{public}d, subSelectState: %{public}d; "
         "keyAction: %{public}d",
-        curSelectState, subSelectState, keyEvent->GetKeyAction());
+        ActiveSlot().curSelectState, ActiveSlot().subSelectState, keyEvent->GetKeyAction());
     ProcessInputEvent(keyEvent);
     SELECTION_HILOGD("After keyEvent, curSelectState: %{public}d, subSelectState: %{public}d",
-        curSelectState, subSelectState);
+        ActiveSlot().curSelectState, ActiveSlot().subSelectState);
 }
 
 void BaseSelectionInputMonitor::OnInputEvent(std::shared_ptr<PointerEvent> pointerEvent) const
 {
-    SELECTION_HILOGD("Before pointerEvent, curSelectState: %{public}d, subSelectState: %{public}d; "
-        "buttonId: %{public}d, pointerAction: %{public}d",
-        curSelectState, subSelectState, pointerEvent->GetButtonId(), pointerEvent->GetPointerAction());
+    SelectSlot(pointerEvent);
+    SELECTION_HILOGD("Before pointerEvent, slot: %{public}zu, curSelectState: %{public}d, subSelectState: %{public}d; "
+        "buttonId: %{public}d, pointerAction: %{public}d", activeSlot_,
+        ActiveSlot().curSelectState, ActiveSlot().subSelectState, pointerEvent->GetButtonId(),
+        pointerEvent->GetPointerAction());
     ProcessInputEvent(pointerEvent);
     SELECTION_HILOGD("After pointerEvent, curSelectState: %{public}d, subSelectState: %{public}d",
-        curSelectState, subSelectState);
+        ActiveSlot().curSelectState, ActiveSlot().subSelectState);
 }
 
-void BaseSelectionInputMonitor::ProcessInputEvent(std::shared_ptr<KeyEvent> keyEvent) const
+bool SelectionPointerSlot::IsButtonHeld() const
 {
-    if (curSelectState == SelectInputState::SELECT_INPUT_DONE) {
-        if (subSelectState != SelectInputSubState::SUB_INITIAL) {
-            curSelectState = SelectInputState::SELECT_INPUT_WORD_END;
-            return;
+    return curSelectState == SelectInputState::SELECT_INPUT_WORD_BEGIN ||
+        subSelectState == SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_UP;
+}
+
+void SelectionPointerSlot::Reset(int32_t device, int32_t display)
+{
+    deviceId = device;
+    displayId = display;
+    curSelectState = SelectInputState::SELECT_INPUT_INITIAL;
+    subSelectState = SelectInputSubState::SUB_INITIAL;
+    lastClickTime = INVALID_CLICK_TIME;
+    touchState = SelectTouchState::TOUCH_IDLE;
+    touchDownTime = 0;
+    selectionInfo = SelectionInfo();
+}
+
+size_t BaseSelectionInputMonitor::FindSlot(int32_t deviceId, int32_t displayId) const
+{
+    for (size_t i = 0; i < slots_.size(); ++i) {
+        if (slots_[i].Matches(deviceId, displayId)) {
+            return i;
         }
-        ResetState();
-        return;
     }
+    return slots_.size();
+}
+
+void BaseSelectionInputMonitor::SelectSlot(const std::shared_ptr<PointerEvent>& pointerEvent) const
+{
+    int32_t deviceId = pointerEvent->GetDeviceId();
+    int32_t displayId = pointerEvent->GetTargetDisplayId();
+    size_t index = FindSlot(deviceId, displayId);
+    // 按住左键拖到另一块屏幕时沿用原槽位，否则拖选会被拆成两段
+    if (index == slots_.size() && ActiveSlot().deviceId == deviceId && ActiveSlot().IsButtonHeld()) {
+        index = activeSlot_;
+    }
+    if (index == slots_.size()) {
+        index = 0;
+        for (size_t i = 1; i < slots_.size(); ++i) {
+            if (slots_[i].lastUsedSeq < slots_[index].lastUsedSeq) {
+                index = i;
+            }
+        }
+        SELECTION_HILOGD("Assign slot %{public}zu to deviceId: %{public}d, displayId: %{public}d",
+            index, deviceId, displayId);
+        slots_[index].Reset(deviceId, displayId);
+    }
+    activeSlot_ = index;
+    slots_[index].lastUsedSeq = ++slotUseSeq_;
+}
 
-    if (subSelectState != SelectInputSubState::SUB_WAIT_KEY_CTRL_DOWN &&
-        subSelectState != SelectInputSubState::SUB_WAIT_KEY_CTRL_UP &&
-        subSelectState != SelectInputSubState::SUB_WAIT_BUTTON_OR_CTRL_DOWN) {
+void BaseSelectionInputMonitor::ProcessInputEvent(const std::shared_ptr<KeyEvent>& keyEvent) const
+{
+    static const std::shared_ptr<PointerEvent> noPointerEvent = nullptr;
+    if (Transit(ClassifyKeyEvent(keyEvent), noPointerEvent, 0)) {
+        FinishedWordSelection();
+    }
+}
+
+void BaseSelectionInputMonitor::ProcessInputEvent(const std::shared_ptr<PointerEvent>& pointerEvent) const
+{
+    int64_t eventTime = GetEventTimeMillis(pointerEvent);
+    if (pointerEvent->GetSourceType() == PointerEvent::SOURCE_TYPE_TOUCHSCREEN) {
+        if (ProcessTouchEvent(pointerEvent, eventTime)) {
+            FinishedWordSelection();
+        }
         return;
     }
+    if (Transit(ClassifyPointerEvent(pointerEvent, eventTime), pointerEvent, eventTime)) {
+        FinishedWordSelection();
+    }
+}
+
+bool BaseSelectionInputMonitor::ProcessTouchEvent(const std::shared_ptr<PointerEvent>& pointerEvent,
+    int64_t eventTime) const
+{
+    SelectTouchEvent event = ClassifyTouchEvent(pointerEvent);
+    // 长按按事件时间戳判定：手指按住期间的下一个事件到达时先补一次长按，划词在抬起时才上报
+    const SelectionPointerSlot& slot = ActiveSlot();
+    if (slot.touchState == SelectTouchState::TOUCH_PRESSED && event != SelectTouchEvent::TOUCH_DOWN &&
+        eventTime - slot.touchDownTime >= TOUCH_LONG_PRESS_TIME) {
+        TransitTouch(SelectTouchEvent::TOUCH_LONG_PRESS, pointerEvent, eventTime);
+    }
+    return TransitTouch(event, pointerEvent, eventTime);
+}
 
+SelectTouchEvent BaseSelectionInputMonitor::ClassifyTouchEvent(const std::shared_ptr<PointerEvent>& pointerEvent) const
+{
+    switch (pointerEvent->GetPointerAction()) {
+        case PointerEvent::POINTER_ACTION_DOWN:
+            return SelectTouchEvent::TOUCH_DOWN;
+        case PointerEvent::POINTER_ACTION_MOVE:
+            return IsTouchSlopExceeded(pointerEvent) ? SelectTouchEvent::TOUCH_MOVE : SelectTouchEvent::TOUCH_MOVE_TINY;
+        case PointerEvent::POINTER_ACTION_UP:
+            return SelectTouchEvent::TOUCH_UP;
+        default:
+            return SelectTouchEvent::TOUCH_CANCEL;
+    }
+}
+
+bool BaseSelectionInputMonitor::TransitTouch(SelectTouchEvent event,
+    const std::shared_ptr<PointerEvent>& pointerEvent, int64_t eventTime) const
+{
+    bool ctrlTriggered = event == SelectTouchEvent::TOUCH_UP && GetCtrlSelectFlag();
+    SelectionPointerSlot& slot = ActiveSlot();
+    const SelectTouchTransition& transition = SelectTouchTransitionTable::Lookup(ctrlTriggered, slot.touchState, event);
+    switch (transition.action) {
+        case SelectInputAction::ACTION_BEGIN:
+            slot.touchDownTime = eventTime;
+            SaveSelectionStartInfo(pointerEvent);
+            break;
+        case SelectInputAction::ACTION_SAVE_END:
+            SaveSelectionEndInfo(pointerEvent);
+            break;
+        default:
+            break;
+    }
+    if (transition.nextState != slot.touchState) {
+        SELECTION_HILOGI("set touchState from %{public}d to %{public}d, event: %{public}d, slot: %{public}zu.",
+            slot.touchState, transition.nextState, static_cast<int32_t>(event), activeSlot_);
+    }
+    slot.touchState = transition.nextState;
+    slot.curSelectState = transition.publicState;
+    slot.subSelectState = transition.publicSubState;
+    return transition.checkFinished;
+}
+
+bool BaseSelectionInputMonitor::IsTouchSlopExceeded(const std::shared_ptr<PointerEvent>& pointerEvent) const
+{
+    PointerEvent::PointerItem pointerItem;
+    pointerEvent->GetPointerItem(pointerEvent->GetPointerId(), pointerItem);
+    const SelectionInfo& selectionInfo = ActiveSlot().selectionInfo;
+    return abs(selectionInfo.startDisplayX - pointerItem.GetGlobalX()) > TOUCH_SLOP ||
+        abs(selectionInfo.startDisplayY - pointerItem.GetGlobalY()) > TOUCH_SLOP;
+}
+
+SelectInputEvent BaseSelectionInputMonitor::ClassifyKeyEvent(const std::shared_ptr<KeyEvent>& keyEvent) const
+{
     int32_t keyCode = keyEvent->GetKeyCode();
-    int32_t action = keyEvent->GetKeyAction();
     if (keyCode != KeyEvent::KEYCODE_CTRL_LEFT && keyCode != KeyEvent::KEYCODE_CTRL_RIGHT) {
-        ResetState();
-        return;
+        return SelectInputEvent::KEY_OTHER;
     }
-    if (action == KeyEvent::KEY_ACTION_DOWN && keyEvent->IsRepeatKey()) {
-        SELECTION_HILOGD("current ctrl down is repeat, ignore");
-        return;
+    int32_t action = keyEvent->GetKeyAction();
+    if (action == KeyEvent::KEY_ACTION_DOWN) {
+        return keyEvent->IsRepeatKey() ? SelectInputEvent::KEY_CTRL_DOWN_REPEAT : SelectInputEvent::KEY_CTRL_DOWN;
     }
-    SELECTION_HILOGI("[SelectionService] Processed ctrl key with action: %{public}d.", action);
-    if ((subSelectState == SelectInputSubState::SUB_WAIT_KEY_CTRL_DOWN ||
-         subSelectState == SelectInputSubState::SUB_WAIT_BUTTON_OR_CTRL_DOWN) &&
-        action == KeyEvent::KEY_ACTION_DOWN) {
-        subSelectState = SelectInputSubState::SUB_WAIT_KEY_CTRL_UP;
-        return;
+    if (action == KeyEvent::KEY_ACTION_UP) {
+        return keyEvent->IsRepeatKey() ? SelectInputEvent::KEY_CTRL_UP_REPEAT : SelectInputEvent::KEY_CTRL_UP;
     }
+    return SelectInputEvent::KEY_CTRL_OTHER;
+}
 
-    if (subSelectState == SelectInputSubState::SUB_WAIT_KEY_CTRL_UP && action == KeyEvent::KEY_ACTION_UP) {
-        if (curSelectState == SelectInputState::SELECT_INPUT_WORD_END) {
-            curSelectState = SelectInputState::SELECT_INPUT_DONE;
-            SELECTION_HILOGI("[SelectionService] Set curSelectState SELECT_INPUT_DONE.");
-        }
-        subSelectState = SelectInputSubState::SUB_INITIAL;
-    } else {
-        if (action == KeyEvent::KEY_ACTION_UP && keyEvent->IsRepeatKey()) {
-            SELECTION_HILOGD("current ctrl up is repeat, ignore");
-            return;
-        }
-        curSelectState = SelectInputState::SELECT_INPUT_INITIAL;
-        subSelectState = SelectInputSubState::SUB_INITIAL;
-        SELECTION_HILOGI("[SelectionService] Set curSelectState SELECT_INPUT_INITIAL.");
+int64_t BaseSelectionInputMonitor::GetEventTimeMillis(const std::shared_ptr<PointerEvent>& pointerEvent) const
+{
+    // 优先使用事件携带的单调时间戳，避免每个事件一次系统调用，也不受系统时间跳变影响
+    int64_t actionTime = pointerEvent->GetActionTime();
+    if (actionTime > 0 || replayMode_) {
+        return actionTime / USEC_PER_MSEC;
     }
-    FinishedWordSelection();
-    return;
+    return GetMonotonicTimeMillis();
 }
 
-void BaseSelectionInputMonitor::ProcessInputEvent(std::shared_ptr<PointerEvent> pointerEvent) const
+void BaseSelectionInputMonitor::SetReplayMode(bool enable)
+{
+    replayMode_ = enable;
+}
+
+SelectInputEvent BaseSelectionInputMonitor::ClassifyPointerEvent(
+    const std::shared_ptr<PointerEvent>& pointerEvent, int64_t eventTime) const
 {
-    int32_t buttonId = pointerEvent->GetButtonId();
     int32_t action = pointerEvent->GetPointerAction();
     if (action == PointerEvent::POINTER_ACTION_ENTER_WINDOW ||
         action == PointerEvent::POINTER_ACTION_LEAVE_WINDOW) {
-        return;
+        return SelectInputEvent::POINTER_IGNORED;
     }
+    int32_t buttonId = pointerEvent->GetButtonId();
     if (buttonId == PointerEvent::BUTTON_NONE && action == PointerEvent::POINTER_ACTION_MOVE) {
-        if (ProcessMovement(pointerEvent)) {
-            return;
+        // 只有等待按下时才需要判断移动距离，避免在悬停移动中拷贝 PointerItem
+        if (ActiveSlot().subSelectState == SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_DOWN &&
+            IsTinyMovement(pointerEvent)) {
+            return SelectInputEvent::POINTER_HOVER_TINY;
         }
+        return SelectInputEvent::POINTER_HOVER;
     }
     if (buttonId != PointerEvent::MOUSE_BUTTON_LEFT) {
-        ResetState();
-        return;
+        return SelectInputEvent::POINTER_OTHER_BUTTON;
+    }
+    switch (action) {
+        case PointerEvent::POINTER_ACTION_BUTTON_DOWN:
+            return ClassifyLeftButtonDown(eventTime);
+        case PointerEvent::POINTER_ACTION_BUTTON_UP:
+            return SelectInputEvent::POINTER_LEFT_UP;
+        case PointerEvent::POINTER_ACTION_MOVE:
+            return SelectInputEvent::POINTER_LEFT_MOVE;
+        default:
+            return SelectInputEvent::POINTER_LEFT_OTHER;
     }
+}
 
-    SELECTION_HILOGD("[SelectionService] into PointerEvent, curSelectState = %{public}d.", curSelectState);
-    switch (curSelectState) {
-        case SelectInputState::SELECT_INPUT_INITIAL:
-            InputInitialProcess(pointerEvent);
-            break;
-
-        case SelectInputState::SELECT_INPUT_WORD_BEGIN:
-            InputWordBeginProcess(pointerEvent);
-            break;
-
-        case SelectInputState::SELECT_INPUT_WAIT_LEFT_MOVE:
-            InputWordLeftMoveProcess(pointerEvent);
-            break;
-
-        case SelectInputState::SELECT_INPUT_WAIT_DOUBLE_CLICK:
-            InputWordDoubleClickProcess(pointerEvent);
-            break;
+SelectInputEvent BaseSelectionInputMonitor::ClassifyLeftButtonDown(int64_t eventTime) const
+{
+    int64_t lastClickTime = ActiveSlot().lastClickTime;
+    if (lastClickTime == INVALID_CLICK_TIME) {
+        return SelectInputEvent::POINTER_LEFT_DOWN_LATE;
+    }
+    auto duration = eventTime - lastClickTime;
+    if (duration <= TRIPLE_CLICK_TIME) {
+        return SelectInputEvent::POINTER_LEFT_DOWN_IN_TRIPLE;
+    }
+    if (duration <= DOUBLE_CLICK_TIME) {
+        return SelectInputEvent::POINTER_LEFT_DOWN_IN_DOUBLE;
+    }
+    return SelectInputEvent::POINTER_LEFT_DOWN_LATE;
+}
 
-        case SelectInputState::SELECT_INPUT_WORD_END:
-            InputWordEndProcess(pointerEvent);
+bool BaseSelectionInputMonitor::Transit(SelectInputEvent event,
+    const std::shared_ptr<PointerEvent>& pointerEvent, int64_t eventTime) const
+{
+    // 触发方式只影响抬起时的转移，其余事件无需读取配置
+    bool ctrlTriggered = event == SelectInputEvent::POINTER_LEFT_UP && GetCtrlSelectFlag();
+    SelectionPointerSlot& slot = ActiveSlot();
+    const SelectInputTransition& transition =
+        SelectInputTransitionTable::Lookup(ctrlTriggered, slot.curSelectState, slot.subSelectState, event);
+    switch (transition.action) {
+        case SelectInputAction::ACTION_BEGIN:
+            slot.lastClickTime = eventTime;
+            SaveSelectionStartInfo(pointerEvent);
             break;
-
-        case SelectInputState::SELECT_INPUT_DONE:
-            InputDoneProcess(pointerEvent);
+        case SelectInputAction::ACTION_STAMP_CLICK:
+            slot.lastClickTime = eventTime;
             break;
-
-        case SelectInputState::SELECT_INPUT_WAIT_TRIPLE_CLICK:
-            InputWordTripleClickProcess(pointerEvent);
+        case SelectInputAction::ACTION_SAVE_END:
+            SaveSelectionEndInfo(pointerEvent);
             break;
-
         default:
             break;
     }
-
-    FinishedWordSelection();
-    return;
-}
-
-bool BaseSelectionInputMonitor::ProcessMovement(std::shared_ptr<PointerEvent> pointerEvent) const
-{
-    if (subSelectState == SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_DOWN) {
-        if (IsTinyMovement(pointerEvent)) {
-            if (curSelectState == SelectInputState::SELECT_INPUT_DONE) {
-                curSelectState = SelectInputState::SELECT_INPUT_WAIT_TRIPLE_CLICK;
-            }
-            return true;
-        }
-    }
-    if (subSelectState == SelectInputSubState::SUB_WAIT_KEY_CTRL_DOWN ||
-        subSelectState == SelectInputSubState::SUB_WAIT_KEY_CTRL_UP) {
-        return true;
-    }
-    if (subSelectState == SelectInputSubState::SUB_WAIT_BUTTON_OR_CTRL_DOWN) {
-        subSelectState = SelectInputSubState::SUB_WAIT_KEY_CTRL_DOWN;
-        return true;
+    if (transition.nextState != slot.curSelectState) {
+        SELECTION_HILOGI("set curSelectState from %{public}d to %{public}d, subSelectState: %{public}d, "
+            "event: %{public}d, slot: %{public}zu.", slot.curSelectState, transition.nextState,
+            transition.nextSubState, static_cast<int32_t>(event), activeSlot_);
     }
-    return false;
+    slot.curSelectState = transition.nextState;
+    slot.subSelectState = transition.nextSubState;
+    return transition.checkFinished;
 }
 
-bool BaseSelectionInputMonitor::IsTinyMovement(std::shared_ptr<PointerEvent> pointerEvent) const
+bool BaseSelectionInputMonitor::IsTinyMovement(const std::shared_ptr<PointerEvent>& pointerEvent) const
 {
     int32_t pointerId = pointerEvent->GetPointerId();
     PointerEvent::PointerItem pointerItem;
     pointerEvent->GetPointerItem(pointerId, pointerItem);
-    if (abs(selectionInfo_.startDisplayX - pointerItem.GetGlobalX()) > MAX_POSITION_CHANGE_OFFSET ||
-        abs(selectionInfo_.startDisplayY - pointerItem.GetGlobalY()) > MAX_POSITION_CHANGE_OFFSET) {
+    const SelectionInfo& selectionInfo = ActiveSlot().selectionInfo;
+    if (abs(selectionInfo.startDisplayX - pointerItem.GetGlobalX()) > MAX_POSITION_CHANGE_OFFSET ||
+        abs(selectionInfo.startDisplayY - pointerItem.GetGlobalY()) > MAX_POSITION_CHANGE_OFFSET) {
         return false;
     }
     return true;
 }
 
-bool BaseSelectionInputMonitor::IsClickTimeout(uint32_t time) const
-{
-    auto curTime = GetCurrentTimeMillis();
-    auto duration = curTime - lastClickTime;
-    lastClickTime = curTime;
-    return (duration > time);
-}
-
 void BaseSelectionInputMonitor::OnInputEvent(std::shared_ptr<AxisEvent> axisEvent) const
 {
     SELECTION_HILOGI("[SelectionService] into axisEvent");
 };
 
-void BaseSelectionInputMonitor::ResetProcess(std::shared_ptr<PointerEvent> pointerEvent) const
-{
-    SELECTION_HILOGI("ResetProcess with action: %{public}d.", pointerEvent->GetPointerAction());
-    curSelectState = SelectInputState::SELECT_INPUT_INITIAL;
-    subSelectState = SelectInputSubState::SUB_INITIAL;
-    OnInputEvent(pointerEvent);
-}
-
-void BaseSelectionInputMonitor::SaveSelectionStartInfo(std::shared_ptr<PointerEvent> pointerEvent) const
+void BaseSelectionInputMonitor::SaveSelectionStartInfo(const std::shared_ptr<PointerEvent>& pointerEvent) const
 {
+    SelectionInfo& selectionInfo = ActiveSlot().selectionInfo;
     int32_t pointerId = pointerEvent->GetPointerId();
     PointerEvent::PointerItem pointerItem;
     pointerEvent->GetPointerItem(pointerId, pointerItem);
-    selectionInfo_.startDisplayX = pointerItem.GetGlobalX();
-    selectionInfo_.startDisplayY = pointerItem.GetGlobalY();
-    selectionInfo_.endDisplayX = pointerItem.GetGlobalX();
-    selectionInfo_.endDisplayY = pointerItem.GetGlobalY();
-    selectionInfo_.startWindowX = pointerItem.GetWindowX();
-    selectionInfo_.startWindowY = pointerItem.GetWindowY();
-    selectionInfo_.endWindowX = pointerItem.GetWindowX();
-    selectionInfo_.endWindowY = pointerItem.GetWindowY();
+    selectionInfo.startDisplayX = pointerItem.GetGlobalX();
+    selectionInfo.startDisplayY = pointerItem.GetGlobalY();
+    selectionInfo.endDisplayX = pointerItem.GetGlobalX();
+    selectionInfo.endDisplayY = pointerItem.GetGlobalY();
+    selectionInfo.startWindowX = pointerItem.GetWindowX();
+    selectionInfo.startWindowY = pointerItem.GetWindowY();
+    selectionInfo.endWindowX = pointerItem.GetWindowX();
+    selectionInfo.endWindowY = pointerItem.GetWindowY();
     int32_t displayId = pointerEvent->GetTargetDisplayId();
     int32_t windowId = pointerEvent->GetTargetWindowId();
     if (displayId < 0 || windowId < 0) {
@@ -266,11 +381,33 @@ void BaseSelectionInputMonitor::SaveSelectionStartInfo(std::shared_ptr<PointerEv
             "windowId: %{public}d", displayId, windowId);
         return;
     }
-    selectionInfo_.displayId = static_cast<std::uint32_t>(displayId);
-    selectionInfo_.windowId = static_cast<std::uint32_t>(windowId);
+    selectionInfo.displayId = static_cast<std::uint32_t>(displayId);
+    selectionInfo.windowId = static_cast<std::uint32_t>(windowId);
+    ResolveBundleNameAsync(windowId);
+}
 
+void BaseSelectionInputMonitor::ResolveBundleNameAsync(int32_t windowId) const
+{
+    if (replayMode_) {
+        return;
+    }
+    // 按下时即提交查询，与后续拖动/点击并行；MMI 回调线程不读取结果，由划词工作线程按窗口ID等待
+    bundleNameResolver_->Request(windowId);
+}
+
+bool BaseSelectionInputMonitor::WaitBundleName(int32_t windowId, std::string& bundleName) const
+{
+    if (bundleNameResolver_->Wait(windowId, bundleName, WINDOW_INFO_WAIT_TIMEOUT_MS)) {
+        return true;
+    }
+    SELECTION_HILOGE("Wait for ListWindowInfo failed or timeout, windowId: %{public}d", windowId);
+    return false;
+}
+
+std::string BaseSelectionInputMonitor::QueryBundleName(int32_t windowId)
+{
     OHOS::Rosen::WindowInfoOption windowInfoOption;
-    windowInfoOption.windowId = static_cast<std::int32_t>(selectionInfo_.windowId);
+    windowInfoOption.windowId = windowId;
     SELECTION_HILOGI("Begin to call ListWindowInfo");
     std::vector<sptr<Rosen::WindowInfo>> infos;
 #ifdef SCENE_BOARD_ENABLE
@@ -286,199 +423,187 @@ void BaseSelectionInputMonitor::SaveSelectionStartInfo(std::shared_ptr<PointerEv
             info->windowLayoutInfo.rect.width_, info->windowLayoutInfo.rect.height_);
     }
     if (ret == Rosen::WMError::WM_OK && !infos.empty()) {
-        selectionInfo_.bundleName = infos[0]->windowMetaInfo.bundleName;
+        return infos[0]->windowMetaInfo.bundleName;
     }
+    return "";
 }
 
-void BaseSelectionInputMonitor::SaveSelectionEndInfo(std::shared_ptr<PointerEvent> pointerEvent) const
+void BaseSelectionInputMonitor::InvalidateWindowBundleName(int32_t windowId) const
 {
-    SaveSelectionType();
-    int32_t pointerId = pointerEvent->GetPointerId();
-    PointerEvent::PointerItem pointerItem;
-    pointerEvent->GetPointerItem(pointerId, pointerItem);
-    selectionInfo_.endDisplayX = pointerItem.GetGlobalX();
-    selectionInfo_.endDisplayY = pointerItem.GetGlobalY();
-    selectionInfo_.endWindowX = pointerItem.GetWindowX();
-    selectionInfo_.endWindowY = pointerItem.GetWindowY();
+    bundleNameCache_->Erase(windowId);
 }
 
-void BaseSelectionInputMonitor::SaveSelectionType() const
+bool WindowBundleNameCache::Get(int32_t windowId, std::string& bundleName)
 {
-    switch (curSelectState) {
-        case SelectInputState::SELECT_INPUT_WAIT_LEFT_MOVE:
-            selectionInfo_.selectionType = MOVE_SELECTION;
-            break;
-        case SelectInputState::SELECT_INPUT_WAIT_DOUBLE_CLICK:
-            selectionInfo_.selectionType = DOUBLE_CLICKED_SELECTION;
-            break;
-        case SelectInputState::SELECT_INPUT_WAIT_TRIPLE_CLICK:
-            selectionInfo_.selectionType = TRIPLE_CLICKED_SELECTION;
-            break;
-        default:
-            break;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = bundleNames_.find(windowId);
+    if (iter == bundleNames_.end()) {
+        return false;
     }
+    bundleName = iter->second;
+    return true;
 }
 
-bool BaseSelectionInputMonitor::IsSelectionDone() const
+void WindowBundleNameCache::Put(int32_t windowId, const std::string& bundleName)
 {
-    return curSelectState == SelectInputState::SELECT_INPUT_DONE;
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (bundleNames_.size() >= MAX_BUNDLE_NAME_CACHE_SIZE && bundleNames_.find(windowId) == bundleNames_.end()) {
+        bundleNames_.clear();
+    }
+    bundleNames_[windowId] = bundleName;
 }
 
-bool BaseSelectionInputMonitor::IsInputWordEnd() const
+void WindowBundleNameCache::Erase(int32_t windowId)
 {
-    return curSelectState == SelectInputState::SELECT_INPUT_WORD_END;
+    std::lock_guard<std::mutex> lock(mutex_);
+    bundleNames_.erase(windowId);
 }
 
-bool BaseSelectionInputMonitor::GetCtrlSelectFlag() const
+WindowBundleNameResolver::WindowBundleNameResolver(std::shared_ptr<WindowBundleNameCache> cache,
+    const QueryFunc& query) : cache_(std::move(cache)), query_(query)
 {
-    return MemSelectionConfig::GetInstance().GetTriggered();
 }
 
-void BaseSelectionInputMonitor::InputInitialProcess(std::shared_ptr<PointerEvent> pointerEvent) const
+WindowBundleNameResolver::~WindowBundleNameResolver()
 {
-    int32_t action = pointerEvent->GetPointerAction();
-    int32_t buttonId = pointerEvent->GetButtonId();
-    if (action == PointerEvent::POINTER_ACTION_BUTTON_DOWN && buttonId == PointerEvent::MOUSE_BUTTON_LEFT) {
-        curSelectState = SelectInputState::SELECT_INPUT_WORD_BEGIN;
-        subSelectState = SelectInputSubState::SUB_INITIAL;
-        lastClickTime = GetCurrentTimeMillis();
-        SaveSelectionStartInfo(pointerEvent);
-        SELECTION_HILOGI("set curSelectState to SELECT_INPUT_WORD_BEGIN.");
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+        pending_.clear();
+    }
+    requestCv_.notify_all();
+    resultCv_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
     }
-    return;
 }
 
-void BaseSelectionInputMonitor::InputWordBeginProcess(std::shared_ptr<PointerEvent> pointerEvent) const
+void WindowBundleNameResolver::Request(int32_t windowId)
 {
-    int32_t action = pointerEvent->GetPointerAction();
-    if (action == PointerEvent::POINTER_ACTION_MOVE) {
-        curSelectState = SelectInputState::SELECT_INPUT_WAIT_LEFT_MOVE;
-        subSelectState = SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_UP;
-        SELECTION_HILOGI("set curSelectState to SELECT_INPUT_WAIT_LEFT_MOVE.");
-    } else if (action == PointerEvent::POINTER_ACTION_BUTTON_UP) {
-        curSelectState = SelectInputState::SELECT_INPUT_WAIT_DOUBLE_CLICK;
-        subSelectState = SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_DOWN;
-        SELECTION_HILOGI("set curSelectState to SELECT_INPUT_WAIT_DOUBLE_CLICK.");
-    }
-    return;
-}
-
-void BaseSelectionInputMonitor::ProcessWordSelection(std::shared_ptr<PointerEvent> pointerEvent) const
-{
-    SaveSelectionEndInfo(pointerEvent);
-    if (GetCtrlSelectFlag()) {
-        if (curSelectState == SelectInputState::SELECT_INPUT_WAIT_DOUBLE_CLICK) {
-            subSelectState = SelectInputSubState::SUB_WAIT_BUTTON_OR_CTRL_DOWN;
-        } else {
-            subSelectState = SelectInputSubState::SUB_WAIT_KEY_CTRL_DOWN;
-        }
-        curSelectState = SelectInputState::SELECT_INPUT_WORD_END;
-        SELECTION_HILOGI("set curSelectState to SELECT_INPUT_WORD_END");
-    } else {
-        if (curSelectState == SelectInputState::SELECT_INPUT_WAIT_DOUBLE_CLICK) {
-            subSelectState = SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_DOWN;
-        } else {
-            subSelectState = SelectInputSubState::SUB_INITIAL;
-        }
-        curSelectState = SelectInputState::SELECT_INPUT_DONE;
-        SELECTION_HILOGI("set curSelectState to SELECT_INPUT_DONE.");
+    std::string cached;
+    if (cache_->Get(windowId, cached)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopping_ || IsQueryingLocked(windowId)) {
+        return;
     }
+    if (pending_.size() >= MAX_PENDING_BUNDLE_NAME_QUERIES) {
+        // 最早的请求已被后续按下覆盖，丢弃后其等待方按查询失败处理
+        pending_.pop_front();
+        resultCv_.notify_all();
+    }
+    pending_.push_back(windowId);
+    if (!worker_.joinable()) {
+        // 首次需要查询时才创建线程，回放模式或全部命中缓存时不占用线程
+        worker_ = std::thread([this]() { Run(); });
+    }
+    requestCv_.notify_one();
 }
 
-void BaseSelectionInputMonitor::InputWordLeftMoveProcess(std::shared_ptr<PointerEvent> pointerEvent) const
+bool WindowBundleNameResolver::Wait(int32_t windowId, std::string& bundleName, uint32_t timeoutMs)
 {
-    int32_t action = pointerEvent->GetPointerAction();
-    if (action == PointerEvent::POINTER_ACTION_BUTTON_UP) {
-        ProcessWordSelection(pointerEvent);
-    } else if (action != PointerEvent::POINTER_ACTION_MOVE) {
-        SELECTION_HILOGI("Action reset. subSelectState is %{public}d, action is %{public}d.", subSelectState, action);
-        ResetProcess(pointerEvent);
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!resultCv_.wait_for(lock, std::chrono::milliseconds(timeoutMs),
+        [this, windowId]() { return stopping_ || !IsQueryingLocked(windowId); })) {
+        return false;
     }
-    return;
+    lock.unlock();
+    return cache_->Get(windowId, bundleName);
 }
 
-void BaseSelectionInputMonitor::JudgeTripleClick(std::shared_ptr<PointerEvent> pointerEvent) const
+bool WindowBundleNameResolver::IsQueryingLocked(int32_t windowId) const
 {
-    if (IsClickTimeout(TRIPLE_CLICK_TIME)) {
-        ResetProcess(pointerEvent);
-        return;
-    }
-    curSelectState = SelectInputState::SELECT_INPUT_WAIT_TRIPLE_CLICK;
-    subSelectState = SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_UP;
-    SELECTION_HILOGI("set curSelectState to SELECT_INPUT_WAIT_TRIPLE_CLICK.");
+    return inFlightWindowId_ == windowId || std::find(pending_.begin(), pending_.end(), windowId) != pending_.end();
 }
 
-void BaseSelectionInputMonitor::InputWordDoubleClickProcess(std::shared_ptr<PointerEvent> pointerEvent) const
+void WindowBundleNameResolver::Run()
 {
-    int32_t action = pointerEvent->GetPointerAction();
-    if (subSelectState == SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_DOWN &&
-        action == PointerEvent::POINTER_ACTION_BUTTON_DOWN) {
-        if (IsClickTimeout(DOUBLE_CLICK_TIME)) {
-            ResetProcess(pointerEvent);
-            return;
+    pthread_setname_np(pthread_self(), "OS_SelectionWin");
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        requestCv_.wait(lock, [this]() { return stopping_ || !pending_.empty(); });
+        if (stopping_) {
+            break;
         }
-        subSelectState = SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_UP;
-        SELECTION_HILOGI("set subSelectState to SUB_WAIT_POINTER_ACTION_BUTTON_UP.");
-        return;
-    }
-    if (subSelectState == SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_UP) {
-        if (action == PointerEvent::POINTER_ACTION_BUTTON_UP) {
-            ProcessWordSelection(pointerEvent);
-        } else if (action == PointerEvent::POINTER_ACTION_MOVE) {
-            curSelectState = SelectInputState::SELECT_INPUT_WAIT_LEFT_MOVE;
-            SELECTION_HILOGI("set curSelectState to SELECT_INPUT_WAIT_LEFT_MOVE.");
+        int32_t windowId = pending_.front();
+        pending_.pop_front();
+        inFlightWindowId_ = windowId;
+        lock.unlock();
+        std::string bundleName = query_(windowId);
+        if (!bundleName.empty()) {
+            cache_->Put(windowId, bundleName);
         }
-        return;
+        lock.lock();
+        inFlightWindowId_ = INVALID_QUERY_WINDOW_ID;
+        resultCv_.notify_all();
     }
-    if (subSelectState == SelectInputSubState::SUB_WAIT_BUTTON_OR_CTRL_DOWN &&
-        action == PointerEvent::POINTER_ACTION_BUTTON_DOWN) {
-        JudgeTripleClick(pointerEvent);
-    }
-    return;
 }
 
-void BaseSelectionInputMonitor::InputWordEndProcess(std::shared_ptr<PointerEvent> pointerEvent) const
+void BaseSelectionInputMonitor::SaveSelectionEndInfo(const std::shared_ptr<PointerEvent>& pointerEvent) const
 {
-    int32_t action = pointerEvent->GetPointerAction();
-    if (action != PointerEvent::POINTER_ACTION_BUTTON_DOWN) {
-        ResetState();
-        return;
-    }
-    if (subSelectState != SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_DOWN &&
-        subSelectState != SelectInputSubState::SUB_WAIT_BUTTON_OR_CTRL_DOWN) {
-        ResetProcess(pointerEvent);
-        return;
+    SelectionInfo& selectionInfo = ActiveSlot().selectionInfo;
+    SaveSelectionType();
+    int32_t pointerId = pointerEvent->GetPointerId();
+    PointerEvent::PointerItem pointerItem;
+    pointerEvent->GetPointerItem(pointerId, pointerItem);
+    selectionInfo.endDisplayX = pointerItem.GetGlobalX();
+    selectionInfo.endDisplayY = pointerItem.GetGlobalY();
+    selectionInfo.endWindowX = pointerItem.GetWindowX();
+    selectionInfo.endWindowY = pointerItem.GetWindowY();
+}
+
+void BaseSelectionInputMonitor::SaveSelectionType() const
+{
+    SelectionPointerSlot& slot = ActiveSlot();
+    switch (slot.curSelectState) {
+        case SelectInputState::SELECT_INPUT_WAIT_LEFT_MOVE:
+            slot.selectionInfo.selectionType = MOVE_SELECTION;
+            break;
+        case SelectInputState::SELECT_INPUT_WAIT_DOUBLE_CLICK:
+            slot.selectionInfo.selectionType = DOUBLE_CLICKED_SELECTION;
+            break;
+        case SelectInputState::SELECT_INPUT_WAIT_TRIPLE_CLICK:
+            slot.selectionInfo.selectionType = TRIPLE_CLICKED_SELECTION;
+            break;
+        default:
+            break;
     }
+}
 
-    SELECTION_HILOGI("Begin JudgeTripleClick.");
-    JudgeTripleClick(pointerEvent);
+bool BaseSelectionInputMonitor::IsSelectionDone() const
+{
+    return ActiveSlot().curSelectState == SelectInputState::SELECT_INPUT_DONE;
 }
 
-void BaseSelectionInputMonitor::InputDoneProcess(std::shared_ptr<PointerEvent> pointerEvent) const
+SelectInputState BaseSelectionInputMonitor::GetSelectState() const
 {
-    InputWordEndProcess(pointerEvent);
+    return ActiveSlot().curSelectState;
 }
 
-void BaseSelectionInputMonitor::InputWordTripleClickProcess(std::shared_ptr<PointerEvent> pointerEvent) const
+bool BaseSelectionInputMonitor::IsInputWordEnd() const
 {
-    int32_t action = pointerEvent->GetPointerAction();
-    if (action == PointerEvent::POINTER_ACTION_BUTTON_DOWN) {
-        SELECTION_HILOGI("[Deprecated] this branch may not be entered.");
-        if (IsClickTimeout(TRIPLE_CLICK_TIME)) {
-            ResetProcess(pointerEvent);
-            return;
-        }
-        subSelectState = SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_UP;
-    } else if (action == PointerEvent::POINTER_ACTION_BUTTON_UP) {
-        ProcessWordSelection(pointerEvent);
-    } else if (action == PointerEvent::POINTER_ACTION_MOVE) {
-        curSelectState = SelectInputState::SELECT_INPUT_WAIT_LEFT_MOVE;
-        SELECTION_HILOGI("set curSelectState to SELECT_INPUT_WAIT_LEFT_MOVE.");
-    } else {
-        SELECTION_HILOGI("Action reset. subSelectState is %{public}d, action is %{public}d.", subSelectState, action);
-        ResetProcess(pointerEvent);
+    return ActiveSlot().curSelectState == SelectInputState::SELECT_INPUT_WORD_END;
+}
+
+bool BaseSelectionInputMonitor::IsHoverInert() const
+{
+    return SelectInputTransitionTable::IsHoverInert(ActiveSlot().curSelectState, ActiveSlot().subSelectState);
+}
+
+bool BaseSelectionInputMonitor::IsHoverInert(int32_t deviceId, int32_t displayId) const
+{
+    size_t index = FindSlot(deviceId, displayId);
+    if (index == slots_.size()) {
+        // 尚未分配槽位的指针处于初始状态，悬停移动不会改变任何状态
+        return true;
     }
-    return;
+    return SelectInputTransitionTable::IsHoverInert(slots_[index].curSelectState, slots_[index].subSelectState);
+}
+
+bool BaseSelectionInputMonitor::GetCtrlSelectFlag() const
+{
+    return MemSelectionConfig::GetInstance().GetTriggered();
 }
 
 void BaseSelectionInputMonitor::FinishedWordSelection() const
@@ -487,51 +612,83 @@ void BaseSelectionInputMonitor::FinishedWordSelection() const
         return;
     }
     GenerateSequenceId();
-    SELECTION_HILOGW("[selectevent] curSelectState:%{public}d. Selection event id is %{public}u.", curSelectState,
-        selSeqId.load());
-}
-
-void BaseSelectionInputMonitor::ResetState() const
-{
-    curSelectState = SelectInputState::SELECT_INPUT_INITIAL;
-    subSelectState = SelectInputSubState::SUB_INITIAL;
-    SELECTION_HILOGD("ResetState.");
+    SELECTION_HILOGW("[selectevent] curSelectState:%{public}d. Selection event id is %{public}u.",
+        ActiveSlot().curSelectState, selSeqId.load());
 }
 
 SelectionInputMonitor::SelectionInputMonitor()
 {
     baseInputMonitor_ = std::make_shared<BaseSelectionInputMonitor>();
+    eventWorker_.Start([this](const SelectionEventRecord& record) { ProcessSelectionEvent(record); });
 }
 
 SelectionInputMonitor::~SelectionInputMonitor()
 {
     SELECTION_HILOGI("~SelectionInputMonitor called");
+    eventWorker_.Stop();
 }
 
 void SelectionInputMonitor::OnInputEvent(std::shared_ptr<KeyEvent> keyEvent) const
 {
+    traceRecorder_.Record(keyEvent);
     baseInputMonitor_->OnInputEvent(keyEvent);
     FinishedWordSelection();
 }
 
+void SelectionInputMonitor::PrewarmOnSelectionStart(SelectInputState preState, SelectInputState curState) const
+{
+    if (preState == curState) {
+        return;
+    }
+    if (curState == SelectInputState::SELECT_INPUT_WORD_BEGIN ||
+        curState == SelectInputState::SELECT_INPUT_WAIT_DOUBLE_CLICK) {
+        // 预热涉及连接锁和定时器，与划词完成事件一样投递给划词工作线程执行
+        SelectionEventRecord record;
+        record.kind = SelectionRecordKind::SELECTION_START;
+        eventWorker_.Post(record);
+    }
+}
+
 void SelectionInputMonitor::HandleWordSelected() const
 {
+    // 划词开始时已预热连接的，这里只需等待在途连接完成
+    SelectionService::GetInstance()->WaitPrewarmedExtAbility();
     if (!SelectionService::GetInstance()->HasExtAbilityConnection()) {
         int32_t ret = SelectionService::GetInstance()->ConnectExtAbilityFromConfig();
         if (ret != 0) {
             SELECTION_HILOGE("start selection extension ability failed");
         }
     }
-    SelectionService::GetInstance()->ResetPluginUnloadTimer();
+    SelectionService::GetInstance()->KeepPluginsAlive();
+}
+
+bool SelectionInputMonitor::ShouldDropPointerEvent(const std::shared_ptr<PointerEvent>& pointerEvent) const
+{
+    // 高回报率鼠标的悬停移动占输入事件的绝大多数，当前状态不响应时直接丢弃
+    // 触摸屏的移动都发生在按下期间，不参与悬停过滤
+    if (pointerEvent->GetPointerAction() != PointerEvent::POINTER_ACTION_MOVE ||
+        pointerEvent->GetButtonId() != PointerEvent::BUTTON_NONE ||
+        pointerEvent->GetSourceType() == PointerEvent::SOURCE_TYPE_TOUCHSCREEN) {
+        return false;
+    }
+    return baseInputMonitor_->IsHoverInert(pointerEvent->GetDeviceId(), pointerEvent->GetTargetDisplayId());
 }
 
 void SelectionInputMonitor::OnInputEvent(std::shared_ptr<PointerEvent> pointerEvent) const
 {
+    traceRecorder_.Record(pointerEvent);
+    if (ShouldDropPointerEvent(pointerEvent)) {
+        droppedMoveEventCount_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    processedPointerEventCount_.fetch_add(1, std::memory_order_relaxed);
     HandleWindowFocused(pointerEvent);
     if (pointerEvent->GetPointerAction() == PointerEvent::POINTER_ACTION_BUTTON_DOWN) {
         SELECTION_HILOGD("Detect multimode event: POINTER_ACTION_BUTTON_DOWN");
     }
+    SelectInputState preState = baseInputMonitor_->GetSelectState();
     baseInputMonitor_->OnInputEvent(pointerEvent);
+    PrewarmOnSelectionStart(preState, baseInputMonitor_->GetSelectState());
     FinishedWordSelection();
 }
 
@@ -550,6 +707,23 @@ void SelectionInputMonitor::SetCanGetSelectionContentFlag(bool flag) const
     SelectionService::GetInstance()->SetPasteboardFlag(flag);
 }
 
+uint64_t SelectionInputMonitor::GetDroppedMoveEventCount() const
+{
+    return droppedMoveEventCount_.load(std::memory_order_relaxed);
+}
+
+uint64_t SelectionInputMonitor::GetProcessedPointerEventCount() const
+{
+    return processedPointerEventCount_.load(std::memory_order_relaxed);
+}
+
+void SelectionInputMonitor::HandleFocusChanged(int32_t windowId) const
+{
+    baseInputMonitor_->InvalidateWindowBundleName(windowId);
+    // 窗口管理已通知过焦点变化，点击回到先前通知过的窗口（A→B→A）时需要重新通知
+    lastNotifiedFocusWindowId_.store(INVALID_FOCUS_WINDOW_ID);
+}
+
 void SelectionInputMonitor::HandleWindowFocused(std::shared_ptr<PointerEvent> pointerEvent) const
 {
     int32_t action = pointerEvent->GetPointerAction();
@@ -557,28 +731,24 @@ void SelectionInputMonitor::HandleWindowFocused(std::shared_ptr<PointerEvent> po
         return;
     }
     auto windowId = pointerEvent->GetTargetWindowId();
-    Rosen::FocusChangeInfo focusInfo;
-#ifdef SCENE_BOARD_ENABLE
-    Rosen::WindowManagerLite::GetInstance().GetFocusWindowInfo(focusInfo);
-#else
-    Rosen::WindowManager::GetInstance().GetFocusWindowInfo(focusInfo);
-#endif
-    auto windowType = static_cast<uint32_t>(focusInfo.windowType_);
-    if (windowId != focusInfo.windowId_) {
+    FocusWindowInfo focusInfo;
+    FocusMonitorManager::GetInstance().GetFocusWindowInfo(focusInfo);
+    if (windowId != focusInfo.windowId) {
         SELECTION_HILOGI("Clicked window is not focused, focus-changed event will dispose selection panel later");
         return;
     }
-    SelectionFocusChangeInfo focusChangeInfo(focusInfo.windowId_, focusInfo.displayId_, focusInfo.pid_,
-        focusInfo.uid_, windowType, true, FocusChangeSource::InputManager);
-    sptr<ISelectionListener> listener = SelectionService::GetInstance()->GetListener();
-    if (listener == nullptr) {
-        SELECTION_HILOGD("Selection listener is nullptr");
+    if (lastNotifiedFocusWindowId_.exchange(focusInfo.windowId) == focusInfo.windowId) {
+        SELECTION_HILOGD("Focused window %{public}d is not changed, skip FocusChange", focusInfo.windowId);
         return;
     }
-    ErrCode errCode = listener->FocusChange(focusChangeInfo);
-    if (errCode != NO_ERROR) {
-        SELECTION_HILOGE("Failed to call ISelectionListener::FocusChange, error code: %{public}d.", errCode);
+    SelectionFocusChangeInfo focusChangeInfo(focusInfo.windowId, focusInfo.displayId, focusInfo.pid,
+        focusInfo.uid, focusInfo.windowType, true, FocusChangeSource::InputManager);
+    if (!SelectionService::GetInstance()->HasListener(SelectionEventMask(SelectionEventType::FOCUS_CHANGE))) {
+        SELECTION_HILOGD("Selection listener is nullptr");
+        lastNotifiedFocusWindowId_.store(INVALID_FOCUS_WINDOW_ID);
+        return;
     }
+    SelectionService::GetInstance()->NotifyFocusChange(focusChangeInfo);
 }
 
 bool SelectionInputMonitor::IsAppInBlocklist(const std::string& bundleName) const
@@ -591,15 +761,31 @@ void SelectionInputMonitor::FinishedWordSelection() const
     if (!baseInputMonitor_->IsSelectionTriggered()) {
         return;
     }
+    // MMI 回调线程只负责投递，拉起扩展与通知监听者在划词工作线程中完成
+    SelectionEventRecord record;
+    record.seqId = selSeqId.load();
+    record.FromSelectionInfo(baseInputMonitor_->GetSelectionInfo());
+    eventWorker_.Post(record);
+}
 
+void SelectionInputMonitor::ProcessSelectionEvent(const SelectionEventRecord& record) const
+{
+    if (record.kind == SelectionRecordKind::SELECTION_START) {
+        SelectionService::GetInstance()->PrewarmExtAbility();
+        return;
+    }
+    int64_t beginTime = SelectionEventWorker::GetMonotonicTimeUs();
     HandleWordSelected();
+    int64_t connectedTime = SelectionEventWorker::GetMonotonicTimeUs();
+    eventWorker_.RecordStage(SelectionStage::CONNECT, connectedTime - beginTime);
 
     if (SelectionService::GetInstance()->GetScreenLockedFlag()) {
         SELECTION_HILOGW("The screen is locked, skip notifying selection info.");
         return;
     }
-    auto selectionInfo = baseInputMonitor_->GetSelectionInfo();
-    if (selectionInfo.bundleName.empty()) {
+    auto selectionInfo = record.ToSelectionInfo();
+    // 投递的事件只带窗口ID，包名在此解析，查询未完成时的等待不占用 MMI 回调线程
+    if (!baseInputMonitor_->WaitBundleName(static_cast<int32_t>(selectionInfo.windowId), selectionInfo.bundleName)) {
         SELECTION_HILOGE("Failed to get Selected bundleName, skip notifying selection info.");
     }
 
@@ -613,16 +799,43 @@ void SelectionInputMonitor::FinishedWordSelection() const
         return;
     }
 
-    SelectionInfoData infoData;
-    infoData.data = selectionInfo;
-
-    sptr<ISelectionListener> listener = SelectionService::GetInstance()->GetListener();
-    if (listener == nullptr) {
+    if (!SelectionService::GetInstance()->HasListener(SelectionEventMask(SelectionEventType::SELECTION))) {
         SELECTION_HILOGE("Selection listener is nullptr");
         return;
     }
     SetCanGetSelectionContentFlag(true);
-    listener->OnSelectionChange(infoData);
+    SetLastNotifiedSelection(record.seqId, selectionInfo);
+    SelectionService::GetInstance()->PrefetchSelectionContent(record.seqId, selectionInfo.windowId,
+        selectionInfo.bundleName, GetSelectionStartPoint(selectionInfo));
+    ErrCode errCode = SelectionService::GetInstance()->NotifySelection(selectionInfo);
+    if (errCode != NO_ERROR) {
+        SELECTION_HILOGE("Failed to notify selection info, error code: %{public}d.", errCode);
+    }
+    eventWorker_.RecordStage(SelectionStage::NOTIFY, SelectionEventWorker::GetMonotonicTimeUs() - connectedTime);
+}
+
+void SelectionInputMonitor::SetLastNotifiedSelection(uint32_t seqId, const SelectionInfo& selectionInfo) const
+{
+    std::lock_guard<std::mutex> lock(lastNotifiedMutex_);
+    lastNotifiedSeqId_ = seqId;
+    lastNotifiedInfo_ = selectionInfo;
+}
+
+uint32_t SelectionInputMonitor::GetLastNotifiedSelection(SelectionInfo& selectionInfo) const
+{
+    std::lock_guard<std::mutex> lock(lastNotifiedMutex_);
+    selectionInfo = lastNotifiedInfo_;
+    return lastNotifiedSeqId_;
+}
+
+SelectionWorkerStats SelectionInputMonitor::GetWorkerStats() const
+{
+    return eventWorker_.GetStats();
+}
+
+SelectionInputTraceRecorder& SelectionInputMonitor::GetTraceRecorder() const
+{
+    return traceRecorder_;
 }
 
 int32_t SelectionInputMonitor::GetSelectionContent(std::string& selectionContent)
@@ -635,8 +848,44 @@ int32_t SelectionInputMonitor::GetSelectionContent(std::string& selectionContent
 
     HisyseventAdapter::GetInstance()->AddSelectionCount();
     SetCanGetSelectionContentFlag(false);
-    auto selectionInfo = baseInputMonitor_->GetSelectionInfo();
+    SelectionInfo selectionInfo;
+    uint32_t seqId = GetLastNotifiedSelection(selectionInfo);
+    int32_t prefetchResult = SelectionServiceError::INVALID_DATA;
+    if (SelectionService::GetInstance()->TakePrefetchedContent(seqId, selectionContent, prefetchResult)) {
+        SELECTION_HILOGI("Use prefetched selection content, ret: %{public}d", prefetchResult);
+        return prefetchResult;
+    }
 
+    SelectionPluginPoint point = GetSelectionStartPoint(selectionInfo);
     return SelectionService::GetInstance()->GetPasteboardContent(selectionContent, selectionInfo.windowId,
-        selectionInfo.bundleName);
+        selectionInfo.bundleName, &point);
+}
+
+int32_t SelectionInputMonitor::GetSelectionContentFd(int32_t& contentFd)
+{
+    SELECTION_HILOGI("SelectionInputMonitor::GetSelectionContentFd start");
+    contentFd = -1;
+    if (!baseInputMonitor_) {
+        SELECTION_HILOGE("baseInputMonitor_ is nullptr");
+        return SelectionServiceError::INVALID_DATA;
+    }
+
+    HisyseventAdapter::GetInstance()->AddSelectionCount();
+    SetCanGetSelectionContentFlag(false);
+    SelectionInfo selectionInfo;
+    uint32_t seqId = GetLastNotifiedSelection(selectionInfo);
+    std::string prefetchedContent;
+    int32_t prefetchResult = SelectionServiceError::INVALID_DATA;
+    if (SelectionService::GetInstance()->TakePrefetchedContent(seqId, prefetchedContent, prefetchResult)) {
+        SELECTION_HILOGI("Use prefetched selection content, ret: %{public}d", prefetchResult);
+        if (prefetchResult != 0) {
+            return prefetchResult;
+        }
+        contentFd = CreateSelectionContentShm(prefetchedContent);
+        return contentFd >= 0 ? 0 : SelectionServiceError::INVALID_DATA;
+    }
+
+    SelectionPluginPoint point = GetSelectionStartPoint(selectionInfo);
+    return SelectionService::GetInstance()->GetPasteboardContentFd(contentFd, selectionInfo.windowId,
+        selectionInfo.bundleName, &point);
 }
\ No newline at end of file
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "selection_input_trace.h"
+
+#include <cerrno>
+#include <cinttypes>
+#include "selection_log.h"
+
+namespace OHOS::SelectionFwk {
+SelectionInputTraceRecorder::~SelectionInputTraceRecorder()
+{
+    Stop();
+}
+
+bool SelectionInputTraceRecorder::Start(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (file_ != nullptr) {
+        SELECTION_HILOGW("input trace is already recording");
+        return false;
+    }
+    file_ = fopen(path.c_str(), "wb");
+    if (file_ == nullptr) {
+        SELECTION_HILOGE("open input trace file failed, errno: %{public}d", errno);
+        return false;
+    }
+    InputTraceHeader header;
+    header.recordSize = static_cast<uint16_t>(sizeof(InputTraceRecord));
+    if (fwrite(&header, sizeof(header), 1, file_) != 1) {
+        SELECTION_HILOGE("write input trace header failed");
+        fclose(file_);
+        file_ = nullptr;
+        return false;
+    }
+    recordCount_ = 0;
+    recording_.store(true);
+    SELECTION_HILOGI("input trace recording started");
+    return true;
+}
+
+void SelectionInputTraceRecorder::Stop()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    recording_.store(false);
+    if (file_ == nullptr) {
+        return;
+    }
+    fclose(file_);
+    file_ = nullptr;
+    SELECTION_HILOGI("input trace recording stopped, records: %{public}" PRIu64, recordCount_);
+}
+
+void SelectionInputTraceRecorder::Record(const std::shared_ptr<PointerEvent>& pointerEvent)
+{
+    if (!IsRecording() || pointerEvent == nullptr) {
+        return;
+    }
+    Write(ToRecord(pointerEvent));
+}
+
+void SelectionInputTraceRecorder::Record(const std::shared_ptr<KeyEvent>& keyEvent)
+{
+    if (!IsRecording() || keyEvent == nullptr) {
+        return;
+    }
+    Write(ToRecord(keyEvent));
+}
+
+uint64_t SelectionInputTraceRecorder::GetRecordCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return recordCount_;
+}
+
+void SelectionInputTraceRecorder::Write(const InputTraceRecord& record)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (file_ == nullptr) {
+        return;
+    }
+    if (recordCount_ >= MAX_INPUT_TRACE_RECORDS || fwrite(&record, sizeof(record), 1, file_) != 1) {
+        SELECTION_HILOGW("input trace stopped at %{public}" PRIu64 " records", recordCount_);
+        recording_.store(false);
+        fclose(file_);
+        file_ = nullptr;
+        return;
+    }
+    recordCount_++;
+}
+
+bool SelectionInputTraceRecorder::Load(const std::string& path, std::vector<InputTraceRecord>& records)
+{
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        SELECTION_HILOGE("open input trace file failed, errno: %{public}d", errno);
+        return false;
+    }
+    InputTraceHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || header.magic != INPUT_TRACE_MAGIC ||
+        header.version != INPUT_TRACE_VERSION || header.recordSize != sizeof(InputTraceRecord)) {
+        SELECTION_HILOGE("invalid input trace header");
+        fclose(file);
+        return false;
+    }
+    InputTraceRecord record;
+    while (records.size() < MAX_INPUT_TRACE_RECORDS && fread(&record, sizeof(record), 1, file) == 1) {
+        records.push_back(record);
+    }
+    fclose(file);
+    return true;
+}
+
+InputTraceRecord SelectionInputTraceRecorder::ToRecord(const std::shared_ptr<PointerEvent>& pointerEvent)
+{
+    InputTraceRecord record;
+    record.type = InputTraceType::POINTER;
+    record.actionTime = pointerEvent->GetActionTime();
+    record.action = pointerEvent->GetPointerAction();
+    record.code = static_cast<int16_t>(pointerEvent->GetButtonId());
+    record.windowId = pointerEvent->GetTargetWindowId();
+    record.displayId = pointerEvent->GetTargetDisplayId();
+    record.deviceId = pointerEvent->GetDeviceId();
+    record.sourceType = static_cast<uint8_t>(pointerEvent->GetSourceType());
+    PointerEvent::PointerItem pointerItem;
+    if (pointerEvent->GetPointerItem(pointerEvent->GetPointerId(), pointerItem)) {
+        record.displayX = pointerItem.GetGlobalX();
+        record.displayY = pointerItem.GetGlobalY();
+    }
+    return record;
+}
+
+InputTraceRecord SelectionInputTraceRecorder::ToRecord(const std::shared_ptr<KeyEvent>& keyEvent)
+{
+    InputTraceRecord record;
+    record.type = InputTraceType::KEY;
+    record.actionTime = keyEvent->GetActionTime();
+    record.deviceId = keyEvent->GetDeviceId();
+    record.action = keyEvent->GetKeyAction();
+    record.code = MaskKeyCode(keyEvent->GetKeyCode());
+    record.isRepeat = keyEvent->IsRepeatKey() ? 1 : 0;
+    return record;
+}
+
+int16_t SelectionInputTraceRecorder::MaskKeyCode(int32_t keyCode)
+{
+    // 与 ClassifyKeyEvent 保持一致：只保留状态机会检查的键码，其他按键不落盘
+    if (keyCode == KeyEvent::KEYCODE_CTRL_LEFT || keyCode == KeyEvent::KEYCODE_CTRL_RIGHT) {
+        return static_cast<int16_t>(keyCode);
+    }
+    return INPUT_TRACE_KEYCODE_OTHER;
+}
+
+std::shared_ptr<PointerEvent> SelectionInputTraceRecorder::ToPointerEvent(const InputTraceRecord& record)
+{
+    std::shared_ptr<PointerEvent> pointerEvent = PointerEvent::Create();
+    if (pointerEvent == nullptr) {
+        return nullptr;
+    }
+    PointerEvent::PointerItem pointerItem;
+    pointerItem.SetPointerId(0);
+    pointerItem.SetGlobalX(record.displayX);
+    pointerItem.SetGlobalY(record.displayY);
+    pointerEvent->SetPointerId(0);
+    pointerEvent->AddPointerItem(pointerItem);
+    pointerEvent->SetPointerAction(record.action);
+    pointerEvent->SetButtonId(record.code);
+    pointerEvent->SetTargetWindowId(record.windowId);
+    pointerEvent->SetTargetDisplayId(record.displayId);
+    pointerEvent->SetDeviceId(record.deviceId);
+    pointerEvent->SetSourceType(record.sourceType);
+    pointerEvent->SetActionTime(record.actionTime);
+    return pointerEvent;
+}
+
+std::shared_ptr<KeyEvent> SelectionInputTraceRecorder::ToKeyEvent(const InputTraceRecord& record)
+{
+    std::shared_ptr<KeyEvent> keyEvent = KeyEvent::Create();
+    if (keyEvent == nullptr) {
+        return nullptr;
+    }
+    keyEvent->SetKeyCode(record.code);
+    keyEvent->SetKeyAction(record.action);
+    keyEvent->SetRepeatKey(record.isRepeat != 0);
+    keyEvent->SetDeviceId(record.deviceId);
+    keyEvent->SetActionTime(record.actionTime);
+    return keyEvent;
+}
+} // namespace OHOS::SelectionFwk
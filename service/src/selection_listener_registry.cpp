@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "selection_listener_registry.h"
+
+#include <algorithm>
+#include <iterator>
+#include "selection_errors.h"
+#include "selection_log.h"
+
+namespace OHOS::SelectionFwk {
+void SelectionListenerDeathRecipient::OnRemoteDied(const wptr<IRemoteObject>& remote)
+{
+    if (handler_ != nullptr) {
+        handler_(remote);
+    }
+}
+
+SelectionListenerRegistry::~SelectionListenerRegistry()
+{
+    Clear();
+}
+
+ErrCode SelectionListenerRegistry::Add(const sptr<ISelectionListener>& listener, uint32_t eventMask, int32_t pid)
+{
+    if (listener == nullptr || listener->AsObject() == nullptr) {
+        SELECTION_HILOGE("Selection listener is nullptr.");
+        return SelectionServiceError::INVALID_DATA;
+    }
+    sptr<IRemoteObject> remote = listener->AsObject();
+    eventMask &= SELECTION_EVENT_MASK_ALL;
+
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    Snapshot current = std::atomic_load(&snapshot_);
+    auto entries = std::make_shared<std::vector<SelectionListenerEntry>>(*current);
+    auto iter = std::find_if(entries->begin(), entries->end(),
+        [&remote](const SelectionListenerEntry& entry) { return entry.remote == remote; });
+    if (iter != entries->end()) {
+        // 重复注册只更新订阅的事件类型
+        iter->eventMask = eventMask;
+        iter->pid = pid;
+        std::atomic_store(&snapshot_, Snapshot(entries));
+        SELECTION_HILOGI("Update selection listener, pid: %{public}d, mask: 0x%{public}x.", pid, eventMask);
+        return NO_ERROR;
+    }
+    if (entries->size() >= MAX_SELECTION_LISTENERS) {
+        SELECTION_HILOGE("Too many selection listeners: %{public}zu.", entries->size());
+        return SelectionServiceError::LISTENER_LIMIT_EXCEEDED;
+    }
+
+    SelectionListenerEntry entry;
+    entry.listener = listener;
+    entry.remote = remote;
+    entry.eventMask = eventMask;
+    entry.pid = pid;
+    entry.batcher = std::make_shared<SelectionNotifyBatcher>([listener](const SelectionEventBatch& eventBatch) {
+        return listener->OnSelectionEvents(eventBatch);
+    });
+    if (remote->IsProxyObject()) {
+        entry.deathRecipient = new (std::nothrow) SelectionListenerDeathRecipient(
+            [this](const wptr<IRemoteObject>& diedRemote) {
+                SELECTION_HILOGW("Selection listener died.");
+                Remove(diedRemote.promote());
+            });
+        if (entry.deathRecipient == nullptr || !remote->AddDeathRecipient(entry.deathRecipient)) {
+            SELECTION_HILOGW("Failed to add death recipient for selection listener, pid: %{public}d.", pid);
+            entry.deathRecipient = nullptr;
+        }
+    }
+    entries->push_back(entry);
+    std::atomic_store(&snapshot_, Snapshot(entries));
+    SELECTION_HILOGI("Add selection listener, pid: %{public}d, mask: 0x%{public}x, count: %{public}zu.", pid,
+        eventMask, entries->size());
+    return NO_ERROR;
+}
+
+bool SelectionListenerRegistry::Remove(const sptr<IRemoteObject>& remote)
+{
+    if (remote == nullptr) {
+        return false;
+    }
+    SelectionListenerEntry removed;
+    {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        Snapshot current = std::atomic_load(&snapshot_);
+        auto iter = std::find_if(current->begin(), current->end(),
+            [&remote](const SelectionListenerEntry& entry) { return entry.remote == remote; });
+        if (iter == current->end()) {
+            return false;
+        }
+        removed = *iter;
+        auto entries = std::make_shared<std::vector<SelectionListenerEntry>>();
+        entries->reserve(current->size() - 1);
+        std::copy_if(current->begin(), current->end(), std::back_inserter(*entries),
+            [&remote](const SelectionListenerEntry& entry) { return entry.remote != remote; });
+        std::atomic_store(&snapshot_, Snapshot(entries));
+    }
+    Detach(removed);
+    SELECTION_HILOGI("Remove selection listener, pid: %{public}d.", removed.pid);
+    return true;
+}
+
+void SelectionListenerRegistry::Clear()
+{
+    Snapshot removed;
+    {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        removed = std::atomic_exchange(&snapshot_, std::make_shared<const std::vector<SelectionListenerEntry>>());
+    }
+    for (const auto& entry : *removed) {
+        Detach(entry);
+    }
+}
+
+SelectionListenerRegistry::Snapshot SelectionListenerRegistry::GetSnapshot() const
+{
+    return std::atomic_load(&snapshot_);
+}
+
+sptr<ISelectionListener> SelectionListenerRegistry::GetPrimaryListener() const
+{
+    Snapshot snapshot = GetSnapshot();
+    for (const auto& entry : *snapshot) {
+        if (entry.Accepts(SelectionEventType::SELECTION)) {
+            return entry.listener;
+        }
+    }
+    return nullptr;
+}
+
+bool SelectionListenerRegistry::HasListener(uint32_t eventMask) const
+{
+    Snapshot snapshot = GetSnapshot();
+    return std::any_of(snapshot->begin(), snapshot->end(),
+        [eventMask](const SelectionListenerEntry& entry) { return (entry.eventMask & eventMask) != 0; });
+}
+
+size_t SelectionListenerRegistry::Size() const
+{
+    return GetSnapshot()->size();
+}
+
+void SelectionListenerRegistry::Post(const SelectionNotifyEvent& event) const
+{
+    Snapshot snapshot = GetSnapshot();
+    for (const auto& entry : *snapshot) {
+        if (entry.Accepts(event.type)) {
+            entry.batcher->Post(event);
+        }
+    }
+}
+
+ErrCode SelectionListenerRegistry::PostAndFlush(const SelectionNotifyEvent& event) const
+{
+    Snapshot snapshot = GetSnapshot();
+    bool accepted = false;
+    ErrCode result = NO_ERROR;
+    for (const auto& entry : *snapshot) {
+        if (!entry.Accepts(event.type)) {
+            continue;
+        }
+        accepted = true;
+        ErrCode ret = entry.batcher->PostAndFlush(event);
+        if (ret != NO_ERROR && result == NO_ERROR) {
+            result = ret;
+        }
+    }
+    return accepted ? result : SelectionServiceError::INVALID_DATA;
+}
+
+void SelectionListenerRegistry::Detach(const SelectionListenerEntry& entry)
+{
+    if (entry.remote != nullptr && entry.deathRecipient != nullptr) {
+        entry.remote->RemoveDeathRecipient(entry.deathRecipient);
+    }
+    if (entry.batcher != nullptr) {
+        entry.batcher->Clear();
+    }
+}
+} // namespace OHOS::SelectionFwk
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "selection_notify_batcher.h"
+
+#include <algorithm>
+#include <iterator>
+#include "selection_log.h"
+#include "selection_timer.h"
+
+namespace OHOS::SelectionFwk {
+namespace {
+size_t CountSelections(std::vector<SelectionNotifyEvent>::const_iterator begin,
+    std::vector<SelectionNotifyEvent>::const_iterator end)
+{
+    return static_cast<size_t>(std::count_if(begin, end,
+        [](const SelectionNotifyEvent& event) { return event.type == SelectionEventType::SELECTION; }));
+}
+} // namespace
+
+SelectionNotifyBatcher::SelectionNotifyBatcher(const Sender& sender, uint32_t coalesceMs, size_t capacity)
+    : sender_(sender), coalesceMs_(coalesceMs), capacity_(std::max<size_t>(capacity, 1))
+{
+    pending_.reserve(std::min<size_t>(capacity_, MAX_SELECTION_EVENT_BATCH_SIZE));
+}
+
+SelectionNotifyBatcher::~SelectionNotifyBatcher()
+{
+    CancelTimer();
+}
+
+bool SelectionNotifyBatcher::Enqueue(const SelectionNotifyEvent& event)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (pending_.size() >= capacity_) {
+        if (pending_.front().type == SelectionEventType::SELECTION) {
+            pendingSelections_--;
+        }
+        pending_.erase(pending_.begin());
+        droppedCount_.fetch_add(1, std::memory_order_relaxed);
+    }
+    pending_.push_back(event);
+    if (event.type == SelectionEventType::SELECTION) {
+        pendingSelections_++;
+    }
+    eventCount_.fetch_add(1, std::memory_order_relaxed);
+    // 已有划词事件待发送时并入其批次，否则立即发送
+    return pending_.size() >= MAX_SELECTION_EVENT_BATCH_SIZE || pendingSelections_ == 0;
+}
+
+void SelectionNotifyBatcher::Post(const SelectionNotifyEvent& event)
+{
+    if (Enqueue(event)) {
+        // 尝试立即发送；若正有批次在发送，由当前发送方或兜底定时器继续发送，投递方不等待
+        std::unique_lock<std::mutex> sendLock(sendMutex_, std::try_to_lock);
+        if (sendLock.owns_lock()) {
+            CancelTimer();
+            SendPending();
+            return;
+        }
+    }
+    StartTimer();
+}
+
+ErrCode SelectionNotifyBatcher::PostAndFlush(const SelectionNotifyEvent& event)
+{
+    Enqueue(event);
+    return Flush();
+}
+
+ErrCode SelectionNotifyBatcher::Flush()
+{
+    CancelTimer();
+    std::lock_guard<std::mutex> sendLock(sendMutex_);
+    return SendPending();
+}
+
+bool SelectionNotifyBatcher::TakeBatch(SelectionEventBatch& batch)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (pending_.empty()) {
+        return false;
+    }
+    if (pending_.size() <= MAX_SELECTION_EVENT_BATCH_SIZE) {
+        batch.events.swap(pending_);
+        pending_.reserve(std::min<size_t>(capacity_, MAX_SELECTION_EVENT_BATCH_SIZE));
+        pendingSelections_ = 0;
+        return true;
+    }
+    auto batchEnd = pending_.begin() + MAX_SELECTION_EVENT_BATCH_SIZE;
+    pendingSelections_ -= CountSelections(pending_.begin(), batchEnd);
+    batch.events.assign(std::make_move_iterator(pending_.begin()), std::make_move_iterator(batchEnd));
+    pending_.erase(pending_.begin(), batchEnd);
+    return true;
+}
+
+ErrCode SelectionNotifyBatcher::SendPending()
+{
+    ErrCode result = NO_ERROR;
+    SelectionEventBatch batch;
+    while (TakeBatch(batch)) {
+        transactionCount_.fetch_add(1, std::memory_order_relaxed);
+        ErrCode ret = sender_ ? sender_(batch) : ERR_INVALID_OPERATION;
+        if (ret != NO_ERROR) {
+            failureCount_.fetch_add(1, std::memory_order_relaxed);
+            SELECTION_HILOGE("Send %{public}zu selection events failed, ret: %{public}d.", batch.events.size(), ret);
+            result = ret;
+        }
+        batch.events.clear();
+    }
+    return result;
+}
+
+void SelectionNotifyBatcher::Clear()
+{
+    CancelTimer();
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.clear();
+    pendingSelections_ = 0;
+}
+
+SelectionNotifyStats SelectionNotifyBatcher::GetStats() const
+{
+    SelectionNotifyStats stats;
+    stats.events = eventCount_.load(std::memory_order_relaxed);
+    stats.transactions = transactionCount_.load(std::memory_order_relaxed);
+    stats.failures = failureCount_.load(std::memory_order_relaxed);
+    stats.dropped = droppedCount_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void SelectionNotifyBatcher::StartTimer()
+{
+    if (timerId_.load() != 0) {
+        return;
+    }
+    std::weak_ptr<SelectionNotifyBatcher> weakBatcher = weak_from_this();
+    uint32_t timerId = SelectionFwkTimer::GetInstance()->Register([weakBatcher]() {
+        auto batcher = weakBatcher.lock();
+        if (batcher != nullptr) {
+            batcher->Flush();
+        }
+    }, coalesceMs_, true);
+    uint32_t expected = 0;
+    if (!timerId_.compare_exchange_strong(expected, timerId)) {
+        // 其他线程已经启动了合并窗口
+        SelectionFwkTimer::GetInstance()->UnRegister(timerId);
+    }
+}
+
+void SelectionNotifyBatcher::CancelTimer()
+{
+    uint32_t timerId = timerId_.exchange(0);
+    if (timerId != 0) {
+        SelectionFwkTimer::GetInstance()->UnRegister(timerId);
+    }
+}
+} // namespace OHOS::SelectionFwk
@@ -18,6 +18,9 @@
 
 #include <chrono>
 #include <thread>
+#include <cinttypes>
+#include <pthread.h>
+#include <unistd.h>
 #include <ipc_skeleton.h>
 #include <dlfcn.h>  // 用于 dlopen/dlsym
 
@@ -28,6 +31,7 @@
 #include "selection_log.h"
 #include <input_manager.h>
 #include "parameter.h"
+#include "param_wrapper.h"
 #include "common_event_manager.h"
 #include "selection_input_monitor.h"
 #include "selection_interface.h"
@@ -53,7 +57,6 @@ using namespace OHOS::EventFwk;
 
 const bool REGISTER_RESULT = SystemAbility::MakeAndRegisterAbility(SelectionService::GetInstance().GetRefPtr());
 const unsigned int TIMEOUT_FOR_CONNECT_DISCONNECT = 5;
-sptr<ISelectionListener> SelectionService::listener_ { nullptr };
 
 SelectionExtensionAbilityConnection::SelectionExtensionAbilityConnection(int32_t userId)
 {
@@ -170,12 +173,17 @@ SelectionService::SelectionService(int32_t saId, bool runOnCreate) : SystemAbili
 SelectionService::~SelectionService()
 {
     SELECTION_HILOGI("[~SelectionService]");
+    StopPrefetchWorker();
 }
 
 sptr<ISelectionListener> SelectionService::GetListener()
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return listener_;
+    return listenerRegistry_.GetPrimaryListener();
+}
+
+bool SelectionService::HasListener(uint32_t eventMask) const
+{
+    return listenerRegistry_.HasListener(eventMask);
 }
 
 ErrCode SelectionService::RegisterListener(const sptr<ISelectionListener>& listener)
@@ -190,13 +198,21 @@ ErrCode SelectionService::RegisterListener(const sptr<ISelectionListener>& liste
         SELECTION_HILOGE("RegisterListener: selection listener is nullptr.");
         return SelectionServiceError::INVALID_DATA;
     }
+    return listenerRegistry_.Add(listener, SELECTION_EVENT_MASK_ALL, pid_.load());
+}
 
-    {
-        std::lock_guard<std::mutex> lock(mutex_);
-        listener_ = listener;
+ErrCode SelectionService::RegisterListenerWithMask(const sptr<ISelectionListener>& listener, uint32_t eventMask)
+{
+    if (!SelectionAppValidator::GetInstance().Validate()) {
+        return SelectionServiceError::UNAUTHENTICATED_ERROR;
     }
-
-    return 0;
+    SELECTION_HILOGI("Enter RegisterListenerWithMask, mask: 0x%{public}x", eventMask);
+    if (listener == nullptr || (eventMask & SELECTION_EVENT_MASK_ALL) == 0) {
+        SELECTION_HILOGE("RegisterListenerWithMask: invalid listener or event mask.");
+        return SelectionServiceError::INVALID_DATA;
+    }
+    // 仅订阅部分事件的观察者不替换扩展进程 pid
+    return listenerRegistry_.Add(listener, eventMask, IPCSkeleton::GetCallingPid());
 }
 
 ErrCode SelectionService::UnregisterListener(const sptr<ISelectionListener>& listener)
@@ -204,8 +220,14 @@ ErrCode SelectionService::UnregisterListener(const sptr<ISelectionListener>& lis
     if (!SelectionAppValidator::GetInstance().Validate()) {
         return SelectionServiceError::UNAUTHENTICATED_ERROR;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    listener_ = nullptr;
+    if (listener == nullptr) {
+        SELECTION_HILOGE("UnregisterListener: selection listener is nullptr.");
+        return SelectionServiceError::INVALID_DATA;
+    }
+    if (!listenerRegistry_.Remove(listener->AsObject())) {
+        SELECTION_HILOGW("UnregisterListener: selection listener is not registered.");
+    }
+    contentSession_.Close(IPCSkeleton::GetCallingPid());
     return 0;
 }
 
@@ -236,11 +258,77 @@ ErrCode SelectionService::GetSelectionContent(std::string& selectionContent)
     return ret;
 }
 
+ErrCode SelectionService::GetSelectionContentFd(int& contentFd)
+{
+    SELECTION_HILOGI("[SelectionService] GetSelectionContentFd in");
+    contentFd = -1;
+    if (!SelectionAppValidator::GetInstance().Validate()) {
+        return SelectionServiceError::UNAUTHENTICATED_ERROR;
+    }
+
+    if (!inputMonitor_) {
+        return SelectionServiceError::INVALID_DATA;
+    }
+
+    if (!inputMonitor_->GetCanGetSelectionContentFlag()) {
+        SELECTION_HILOGE("GetSelectionContentFd at wrong timing.");
+        return SelectionServiceError::INVALID_TIMING;
+    }
+
+    // 回复中的 fd 由 IPC 桩写入后关闭
+    return inputMonitor_->GetSelectionContentFd(contentFd);
+}
+
+ErrCode SelectionService::OpenSelectionContent(uint32_t& contentLength)
+{
+    SELECTION_HILOGI("[SelectionService] OpenSelectionContent in");
+    contentLength = 0;
+    if (!SelectionAppValidator::GetInstance().Validate()) {
+        return SelectionServiceError::UNAUTHENTICATED_ERROR;
+    }
+
+    if (!inputMonitor_) {
+        return SelectionServiceError::INVALID_DATA;
+    }
+
+    if (!inputMonitor_->GetCanGetSelectionContentFlag()) {
+        SELECTION_HILOGE("OpenSelectionContent at wrong timing.");
+        return SelectionServiceError::INVALID_TIMING;
+    }
+
+    int32_t contentFd = -1;
+    int32_t ret = inputMonitor_->GetSelectionContentFd(contentFd);
+    if (ret != 0) {
+        if (contentFd >= 0) {
+            close(contentFd);
+        }
+        return ret;
+    }
+    return contentSession_.Open(contentFd, IPCSkeleton::GetCallingPid(), contentLength);
+}
+
+ErrCode SelectionService::ReadSelectionContentChunk(uint32_t offset, uint32_t maxLength, std::string& chunk)
+{
+    if (!SelectionAppValidator::GetInstance().Validate()) {
+        return SelectionServiceError::UNAUTHENTICATED_ERROR;
+    }
+    return contentSession_.Read(IPCSkeleton::GetCallingPid(), offset, maxLength, chunk);
+}
+
+ErrCode SelectionService::CloseSelectionContent()
+{
+    if (!SelectionAppValidator::GetInstance().Validate()) {
+        return SelectionServiceError::UNAUTHENTICATED_ERROR;
+    }
+    contentSession_.Close(IPCSkeleton::GetCallingPid());
+    return 0;
+}
+
 int32_t SelectionService::Dump(int32_t fd, const std::vector<std::u16string> &args)
 {
     SELECTION_HILOGI("Dump start.");
     std::string command = "";
-    if (args.size() == 1) {
+    if (!args.empty()) {
         command = Str16ToStr8(args.at(0));
     }
     if (command == "-h") {
@@ -249,7 +337,8 @@ int32_t SelectionService::Dump(int32_t fd, const std::vector<std::u16string> &ar
         result.append("Usage:dump  <command> [options]\n")
             .append("Description:\n")
             .append("-h show help\n")
-            .append("-a dump all selection variables\n");
+            .append("-a dump all selection variables\n")
+            .append("-r start|stop record input events to ").append(DEFAULT_INPUT_TRACE_PATH).append("\n");
         dprintf(fd, "%s\n", result.c_str());
     } else if (command == "-a") {
         SELECTION_HILOGI("Dump start -a.");
@@ -261,6 +350,21 @@ int32_t SelectionService::Dump(int32_t fd, const std::vector<std::u16string> &ar
         dprintf(fd, "extension.pid: %d\n", pid_.load());
         dprintf(fd, "inputmanager.monitorId: %d\n", inputMonitorId_);
         dprintf(fd, "isScreenLocked: %d\n", isScreenLocked_.load());
+        dprintf(fd, "extension.prewarm: idleMs=%d started=%" PRIu64 " used=%" PRIu64 " cancelled=%" PRIu64 "\n",
+            prewarmIdleTimeoutMs_.load(), prewarmStartedCount_.load(), prewarmUsedCount_.load(),
+            prewarmCancelledCount_.load());
+        dprintf(fd, "content.prefetch: enabled=%d started=%" PRIu64 " hit=%" PRIu64 " miss=%" PRIu64 "\n",
+            contentPrefetchEnabled_.load(), prefetchStartedCount_.load(), prefetchHitCount_.load(),
+            prefetchMissCount_.load());
+        if (inputMonitor_ != nullptr) {
+            dprintf(fd, "input.pointer.processed: %" PRIu64 "\n", inputMonitor_->GetProcessedPointerEventCount());
+            dprintf(fd, "input.pointer.droppedMove: %" PRIu64 "\n", inputMonitor_->GetDroppedMoveEventCount());
+            DumpWorkerStats(fd, inputMonitor_->GetWorkerStats());
+        }
+        DumpListeners(fd);
+        DumpPluginStats(fd);
+    } else if (command == "-r" && args.size() == 2) {
+        DumpTraceCommand(fd, Str16ToStr8(args.at(1)));
     } else {
         SELECTION_HILOGI("Dump start -other.");
         dprintf(fd, "selection dump parameter error,enter '-h' for usage.\n");
@@ -326,27 +430,14 @@ void SelectionService::PersistSelectionConfig()
     auto selectionConfig = MemSelectionConfig::GetInstance().GetSelectionConfig();
     SELECTION_HILOGI("========== PersistSelectionConfig: Start ==========");
 
-    std::shared_lock<std::shared_mutex> readLock(pluginMutex_);
-    if (!pluginSo_) {
-        readLock.unlock();
-        if (!LoadPluginSo()) {
-            SELECTION_HILOGW("Using in-memory config as fallback, service continues to run");
-            return;
-        }
-        readLock.lock();
-        if (!pluginSo_) {
-            SELECTION_HILOGW("Plugin unloaded during operation, using in-memory config as fallback");
-            return;
-        }
+    auto api = AcquirePluginApi(PLUGIN_DATABASE);
+    if (!api) {
+        SELECTION_HILOGW("Using in-memory config as fallback, service continues to run");
+        return;
     }
-
-    if (databaseSave_) {
-        int ret = databaseSave_(GetUserId(), &selectionConfig);
-        if (ret != SELECTION_CONFIG_OK) {
-            SELECTION_HILOGE("Save database failed. ret = %{public}d", ret);
-        }
-    } else {
-        SELECTION_HILOGE("DatabaseSaveConfig function not available");
+    int ret = api->databaseSaveConfig(GetUserId(), &selectionConfig);
+    if (ret != SELECTION_CONFIG_OK) {
+        SELECTION_HILOGE("Save database failed. ret = %{public}d", ret);
     }
 
     SELECTION_HILOGI("========== PersistSelectionConfig: End ==========");
@@ -377,6 +468,11 @@ void SelectionService::Init()
     SynchronizeSelectionConfig();
     RegisterSystemAbilityStatusChangeListener();
     WatchParams();
+    prewarmIdleTimeoutMs_.store(OHOS::system::GetIntParameter<int32_t>(SYS_SELECTION_PREWARM_IDLE,
+        DEFAULT_PREWARM_IDLE_TIMEOUT_MS, 0, MAX_PREWARM_IDLE_TIMEOUT_MS));
+    SELECTION_HILOGI("prewarm idle timeout: %{public}d ms", prewarmIdleTimeoutMs_.load());
+    contentPrefetchEnabled_.store(OHOS::system::GetBoolParameter(SYS_SELECTION_CONTENT_PREFETCH, false));
+    SELECTION_HILOGI("content prefetch: %{public}d", contentPrefetchEnabled_.load());
 }
 
 void SelectionService::Shutdown()
@@ -400,20 +496,16 @@ int32_t SelectionService::DoConnectNewExtAbility(const std::string& bundleName,
         return SELECTION_CONFIG_FAILURE;
     }
 
-    if (!LoadPluginSo()) {
-        SELECTION_HILOGE("Ability manager plugin not available");
-        connectInner_ = nullptr;
-        return SELECTION_CONFIG_FAILURE;
-    }
-
-    std::shared_lock<std::shared_mutex> readLock(pluginMutex_);
-    if (!pluginSo_ || !abilityConnect_) {
-        SELECTION_HILOGE("Ability manager plugin not available after load");
-        connectInner_ = nullptr;
-        return SELECTION_CONFIG_FAILURE;
+    int32_t ret = SELECTION_CONFIG_FAILURE;
+    {
+        auto api = AcquirePluginApi(PLUGIN_ABILITY_MANAGER);
+        if (!api) {
+            SELECTION_HILOGE("Ability manager plugin not available");
+            connectInner_ = nullptr;
+            return SELECTION_CONFIG_FAILURE;
+        }
+        ret = api->abilityConnect(&want, &connectInner_, userId);
     }
-
-    auto ret = abilityConnect_(&want, &connectInner_, userId);
     if (ret != 0) {
         SELECTION_HILOGE("[selectevent] StartExtensionAbility failed. error code is %{public}d.", ret);
         connectInner_ = nullptr;
@@ -440,17 +532,17 @@ void SelectionService::DoDisconnectCurrentExtAbility()
     connectInner_->InitDisconnectPromise();
 
     // 如果插件已卸载，直接清理连接对象，不重新加载插件
-    std::shared_lock<std::shared_mutex> readLock(pluginMutex_);
-    if (!abilityDisconnect_) {
-        readLock.unlock();
-        SELECTION_HILOGW("Ability manager plugin not available, clean up connection only");
-        connectInner_->DestroyDisconnectPromise();
-        connectInner_ = nullptr;
-        return;
+    int32_t ret = ERR_OK;
+    {
+        PluginApiGuard api(plugins_[PLUGIN_ABILITY_MANAGER]);
+        if (!api) {
+            SELECTION_HILOGW("Ability manager plugin not available, clean up connection only");
+            connectInner_->DestroyDisconnectPromise();
+            connectInner_ = nullptr;
+            return;
+        }
+        ret = api->abilityDisconnect(&connectInner_);
     }
-
-    int32_t ret = abilityDisconnect_(&connectInner_);
-    readLock.unlock();
     if (ret != ERR_OK) {
         connectInner_->DestroyDisconnectPromise();
         SELECTION_HILOGE("DisconnectServiceAbility failed, ret: %{public}d", ret);
@@ -654,27 +746,14 @@ void SelectionService::SynchronizeSelectionConfig()
 
 std::optional<SelectionConfig> SelectionService::LoadDatabaseSelectionConfig()
 {
-    std::shared_lock<std::shared_mutex> readLock(pluginMutex_);
-    if (!pluginSo_) {
-        readLock.unlock();
-        if (!LoadPluginSo()) {
-            SELECTION_HILOGW("Using system default config as fallback");
-            return std::nullopt;
-        }
-        readLock.lock();
-        if (!pluginSo_) {
-            SELECTION_HILOGW("Plugin unloaded during operation, using fallback");
-            return std::nullopt;
-        }
-    }
-
-    if (!databaseGet_) {
-        SELECTION_HILOGE("Database_GetConfig function not available");
+    auto api = AcquirePluginApi(PLUGIN_DATABASE);
+    if (!api) {
+        SELECTION_HILOGW("Using system default config as fallback");
         return std::nullopt;
     }
 
     SelectionConfig config;
-    int ret = databaseGet_(userId_.load(), &config);
+    int ret = api->databaseGetConfig(userId_.load(), &config);
     if (ret == 0) {
         return config;
     } else if (ret == SELECTION_CONFIG_NOT_FOUND) {
@@ -694,16 +773,12 @@ void SelectionService::SyncConfigToSystem(const SelectionConfig& config)
 
 void SelectionService::SyncConfigToDatabase(int32_t userId, const SelectionConfig& config)
 {
-    if (!LoadPluginSo()) {
-        SELECTION_HILOGW("Config saved to system params as fallback");
-        return;
-    }
-    std::shared_lock<std::shared_mutex> readLock(pluginMutex_);
-    if (!pluginSo_ || !databaseSave_) {
+    auto api = AcquirePluginApi(PLUGIN_DATABASE);
+    if (!api) {
         SELECTION_HILOGW("Config saved to system params as fallback");
         return;
     }
-    auto ret = databaseSave_(userId, &config);
+    auto ret = api->databaseSaveConfig(userId, &config);
     if (ret != SELECTION_CONFIG_OK) {
         SELECTION_HILOGE("Save database failed. ret = %{public}d", ret);
     }
@@ -789,7 +864,10 @@ void SelectionService::OnStop()
 {
     SELECTION_HILOGI("[selectevent][SelectionService][OnStop]begin");
     Shutdown();
+    StopPrefetchWorker();
+    StopPluginReaper();
     UnloadPluginSo();
+    WaitPluginSoReclaimed();
     SELECTION_HILOGI("[selectevent][SelectionService][OnStop]end.");
 }
 
@@ -878,6 +956,67 @@ void SelectionService::InputMonitorCancel()
     }
 }
 
+void SelectionService::DumpListeners(int32_t fd)
+{
+    auto snapshot = listenerRegistry_.GetSnapshot();
+    dprintf(fd, "listener.count: %zu\n", snapshot->size());
+    for (size_t i = 0; i < snapshot->size(); ++i) {
+        const SelectionListenerEntry& entry = snapshot->at(i);
+        SelectionNotifyStats stats = entry.batcher->GetStats();
+        dprintf(fd, "listener[%zu]: pid=%d mask=0x%x events=%" PRIu64 " transactions=%" PRIu64 " failures=%" PRIu64
+            " dropped=%" PRIu64 "\n", i, entry.pid, entry.eventMask, stats.events, stats.transactions,
+            stats.failures, stats.dropped);
+    }
+}
+
+void SelectionService::DumpPluginStats(int32_t fd)
+{
+    for (uint32_t module = 0; module < PLUGIN_MODULE_COUNT; ++module) {
+        PluginApiGuard api(plugins_[module]);
+        dprintf(fd, "plugin[%s]: loaded=%d abi=%u capabilities=0x%x\n", PLUGIN_MODULE_NAMES[module],
+            static_cast<bool>(api), api ? api->abiVersion : 0, api ? api->capabilities : 0);
+    }
+    // 插件未加载时不为 dump 加载插件；统计接口为可选能力
+    PluginApiGuard api(plugins_[PLUGIN_PASTEBOARD]);
+    if (api && (api->capabilities & SELECTION_PLUGIN_CAP_PASTEBOARD_DUMP) != 0 && api->pasteboardDumpStats != nullptr) {
+        api->pasteboardDumpStats(fd);
+    }
+}
+
+void SelectionService::DumpTraceCommand(int32_t fd, const std::string &option)
+{
+    if (inputMonitor_ == nullptr) {
+        dprintf(fd, "input monitor is not initialized.\n");
+        return;
+    }
+    auto &recorder = inputMonitor_->GetTraceRecorder();
+    if (option == "start") {
+        bool ret = recorder.Start(DEFAULT_INPUT_TRACE_PATH);
+        dprintf(fd, "input trace start %s: %s\n", ret ? "success" : "failed", DEFAULT_INPUT_TRACE_PATH);
+    } else if (option == "stop") {
+        recorder.Stop();
+        dprintf(fd, "input trace stopped, records: %" PRIu64 "\n", recorder.GetRecordCount());
+    } else {
+        dprintf(fd, "selection dump parameter error,enter '-h' for usage.\n");
+    }
+}
+
+void SelectionService::DumpWorkerStats(int32_t fd, const SelectionWorkerStats &stats)
+{
+    static const char *stageNames[] = { "queueWait", "connect", "notify" };
+    static_assert(sizeof(stageNames) / sizeof(stageNames[0]) == static_cast<size_t>(SelectionStage::STAGE_COUNT),
+        "stage names must match SelectionStage");
+    dprintf(fd, "worker.queue.depth: %zu\n", stats.queueDepth);
+    dprintf(fd, "worker.queue.maxDepth: %zu\n", stats.maxQueueDepth);
+    dprintf(fd, "worker.queue.dropped: %" PRIu64 "\n", stats.dropped);
+    for (size_t i = 0; i < stats.stages.size(); ++i) {
+        const auto &stage = stats.stages[i];
+        uint64_t avgUs = stage.count == 0 ? 0 : stage.totalUs / stage.count;
+        dprintf(fd, "worker.latency.%s: count=%" PRIu64 " avgUs=%" PRIu64 " maxUs=%" PRIu64 "\n",
+            stageNames[i], stage.count, avgUs, stage.maxUs);
+    }
+}
+
 void SelectionService::InitFocusChangedMonitor()
 {
     SELECTION_HILOGI("[SelectionService] init focus changed monitor");
@@ -902,15 +1041,30 @@ void SelectionService::CancelFocusChangedMonitor()
 void SelectionService::HandleFocusChanged(const sptr<Rosen::FocusChangeInfo> &focusChangeInfo, bool isFocused)
 {
     SELECTION_HILOGI("[SelectionService] handle focus changed");
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (listener_ == nullptr || focusChangeInfo == nullptr) {
-        SELECTION_HILOGE("listener_ or focusChangeInfo is nullptr.");
+    if (inputMonitor_ != nullptr && focusChangeInfo != nullptr) {
+        inputMonitor_->HandleFocusChanged(focusChangeInfo->windowId_);
+    }
+    if (!HasListener(SelectionEventMask(SelectionEventType::FOCUS_CHANGE)) ||
+        focusChangeInfo == nullptr) {
+        SELECTION_HILOGE("focus listener or focusChangeInfo is nullptr.");
         return;
     }
     auto windowType = static_cast<uint32_t>(focusChangeInfo->windowType_);
     SelectionFocusChangeInfo selectionFocusChangeInfo(focusChangeInfo->windowId_, focusChangeInfo->displayId_,
         focusChangeInfo->pid_, focusChangeInfo->uid_, windowType, isFocused, FocusChangeSource::WindowManager);
-    listener_->FocusChange(selectionFocusChangeInfo);
+    NotifyFocusChange(selectionFocusChangeInfo);
+}
+
+void SelectionService::NotifyFocusChange(const SelectionFocusChangeInfo& focusChangeInfo)
+{
+    listenerRegistry_.Post(SelectionNotifyEvent::FromFocusChange(focusChangeInfo));
+}
+
+ErrCode SelectionService::NotifySelection(const SelectionInfo& selectionInfo)
+{
+    // 新的划词使上一次的分块读取会话失效
+    contentSession_.Close(-1);
+    return listenerRegistry_.PostAndFlush(SelectionNotifyEvent::FromSelection(selectionInfo));
 }
 
 void SelectionService::SubscribeSysEventReceiver()
@@ -981,130 +1135,334 @@ void SelectionService::PerformParamBootCompleted(const char* key, const char* va
     Init();
 }
 
-bool SelectionService::LoadPluginSo()
+bool SelectionService::LoadPluginSo(PluginModule module)
 {
-    std::unique_lock<std::shared_mutex> lock(pluginMutex_);
-    if (pluginSo_) {
-        ResetPluginUnloadTimer();  //新增已加载分支也重置
+    auto& plugin = plugins_[module];
+    std::unique_lock<std::mutex> lock(plugin.mutex);
+    // 上一次卸载仍在后台回收时，等其 dlclose 完成再加载，避免新实例与旧实例的 cleanup 共用插件内状态；
+    // 排空等待放在锁外，不阻塞同模块的卸载和其他加载者
+    while (plugin.Current() == nullptr && plugin.reclaimFuture.valid()) {
+        if (PluginApiGuard::IsHeldByCurrentThread(plugin.reclaiming.get())) {
+            // 调用方仍持有旧实例的接口表，等待旧实例回收会与回收方互相等待
+            SELECTION_HILOGE("Plugin %{public}s is reclaiming and held by current thread", PLUGIN_MODULE_NAMES[module]);
+            return false;
+        }
+        AwaitPluginReclaim(plugin, lock);
+    }
+    if (plugin.Current() != nullptr) {
+        plugin.lastUsedMs.store(GetPluginClockMs(), std::memory_order_relaxed);
         return true;  // 已加载
     }
 
-    pluginSo_ = dlopen(PLUGIN_SO_PATH, RTLD_LAZY);
-    if (!pluginSo_) {
-        SELECTION_HILOGE("Failed to dlopen %{public}s: %{public}s", PLUGIN_SO_PATH, dlerror());
+    void* handle = dlopen(PLUGIN_SO_PATHS[module], RTLD_LAZY);
+    if (!handle) {
+        SELECTION_HILOGE("Failed to dlopen %{public}s: %{public}s", PLUGIN_SO_PATHS[module], dlerror());
         return false;
     }
-
-    // 加载数据库函数
-    databaseSave_ = (DatabaseSaveConfigFunc)dlsym(pluginSo_, "DatabaseSaveConfig");
-    databaseGet_ = (DatabaseGetConfigFunc)dlsym(pluginSo_, "DatabaseGetConfig");
-    databaseAvailable_ = (DatabaseIsAvailableFunc)dlsym(pluginSo_, "DatabaseIsAvailable");
-
-    // 加载能力管理函数
-    abilityConnect_ = (AbilityManagerConnectFunc)dlsym(pluginSo_, "AbilityManagerConnectAbility");
-    abilityDisconnect_ = (AbilityManagerDisconnectFunc)dlsym(pluginSo_, "AbilityManagerDisconnectAbility");
-    abilityAvailable_ = (AbilityManagerIsAvailableFunc)dlsym(pluginSo_, "AbilityManagerIsAvailable");
-
-    // 加载剪贴板函数
-    pasteboardGetContent_ = (PasteboardGetContentFunc)dlsym(pluginSo_, "PasteboardGetSelectionContent");
-    pasteboardCanGetContent_ = (PasteboardCanGetContentFunc)dlsym(pluginSo_, "PasteboardCanGetSelectionContent");
-    pasteboardSetFlag_ = (PasteboardSetFlagFunc)dlsym(pluginSo_, "PasteboardSetCanGetSelectionContentFlag");
-    if (!databaseSave_ || !databaseGet_ || !databaseAvailable_ ||
-        !abilityConnect_ || !abilityDisconnect_ || !abilityAvailable_ ||
-        !pasteboardGetContent_ || !pasteboardCanGetContent_ || !pasteboardSetFlag_) {
-        SELECTION_HILOGE("Failed to load plugin functions");
-        dlclose(pluginSo_);
-        pluginSo_ = nullptr;
+    const SelectionPluginApi* api = ResolvePluginApi(module, handle);
+    if (api == nullptr) {
+        dlclose(handle);
         return false;
     }
+    plugin.lastUsedMs.store(GetPluginClockMs(), std::memory_order_relaxed);
+    std::atomic_store(&plugin.generation, std::make_shared<PluginGeneration>(handle, api));
 
-    SELECTION_HILOGI("Plugin so loaded successfully");
-    ResetPluginUnloadTimer();  // 启动/重置5分钟卸载定时器
+    SELECTION_HILOGI("Plugin %{public}s loaded successfully, abi: %{public}u", PLUGIN_SO_PATHS[module],
+        api->abiVersion);
+    StartPluginReaper();
     return true;
 }
 
-void SelectionService::UnloadPluginSo()
+const SelectionPluginApi* SelectionService::ResolvePluginApi(PluginModule module, void* handle)
 {
-    std::unique_lock<std::shared_mutex> lock(pluginMutex_);
-    // 取消卸载定时器
-    if (pluginUnloadTimerId_.load() != 0) {
-        SelectionFwkTimer::GetInstance()->UnRegister(pluginUnloadTimerId_.load());
-        pluginUnloadTimerId_.store(0);
+    auto getApi = reinterpret_cast<GetSelectionPluginApiFunc>(dlsym(handle, SELECTION_PLUGIN_API_SYMBOL));
+    if (getApi == nullptr) {
+        SELECTION_HILOGE("Failed to find %{public}s in %{public}s", SELECTION_PLUGIN_API_SYMBOL,
+            PLUGIN_SO_PATHS[module]);
+        return nullptr;
+    }
+    const SelectionPluginApi* api = getApi(SELECTION_PLUGIN_API_VERSION);
+    // 插件只在接口表末尾追加字段，版本号和结构体大小不小于服务端即可兼容
+    if (api == nullptr || api->abiVersion < SELECTION_PLUGIN_API_VERSION ||
+        api->structSize < sizeof(SelectionPluginApi)) {
+        SELECTION_HILOGE("Plugin %{public}s api mismatch, required version: %{public}u", PLUGIN_MODULE_NAMES[module],
+            SELECTION_PLUGIN_API_VERSION);
+        return nullptr;
     }
+    uint32_t required = PLUGIN_MODULE_CAPABILITIES[module];
+    if ((api->capabilities & required) != required || api->cleanup == nullptr) {
+        SELECTION_HILOGE("Plugin %{public}s capabilities 0x%{public}x, required 0x%{public}x",
+            PLUGIN_MODULE_NAMES[module], api->capabilities, required);
+        return nullptr;
+    }
+    return api;
+}
 
-    if (pluginSo_) {
-        // 调用清理函数
-        auto cleanupFunc = (void(*)())dlsym(pluginSo_, "PluginCleanupAll");
-        if (cleanupFunc) {
-            cleanupFunc();
+SelectionService::PluginApiGuard SelectionService::AcquirePluginApi(PluginModule module)
+{
+    auto& plugin = plugins_[module];
+    for (uint32_t attempt = 0; attempt <= PLUGIN_LOAD_RETRY_TIMES; ++attempt) {
+        {
+            PluginApiGuard api(plugin);
+            if (api) {
+                // 保活只刷新最近使用时间，空闲卸载由周期巡检完成
+                plugin.lastUsedMs.store(GetPluginClockMs(), std::memory_order_relaxed);
+                return api;
+            }
+        }
+        // 接口表为空（未加载或已摘除）时加载新实例，上一实例仍在回收时加载方会等待其完成
+        if (!LoadPluginSo(module)) {
+            break;
         }
+    }
+    SELECTION_HILOGE("Plugin %{public}s not available", PLUGIN_MODULE_NAMES[module]);
+    return PluginApiGuard(plugin);
+}
+
+void SelectionService::UnloadPluginSo(PluginModule module)
+{
+    auto& plugin = plugins_[module];
+    std::lock_guard<std::mutex> lock(plugin.mutex);
+    // 先摘除当前实例，之后的调用视为插件未加载，需要时重新加载为新实例
+    std::shared_ptr<PluginGeneration> generation = std::atomic_exchange(&plugin.generation,
+        std::shared_ptr<PluginGeneration>());
+    if (generation == nullptr || generation->handle == nullptr) {
+        return;
+    }
+    // 等待在途调用、cleanup 和 dlclose 放到后台执行，不阻塞调用方和其他插件调用
+    plugin.reclaiming = generation;
+    plugin.reclaimFuture = std::async(std::launch::async, [this, module, generation]() {
+        ReclaimPluginSo(module, generation);
+    }).share();
+}
+
+void SelectionService::ReclaimPluginSo(PluginModule module, const std::shared_ptr<PluginGeneration>& generation)
+{
+    // 实例摘除后不再有新读者登记到它，只需等待旧实例的读者计数归零，新实例上的调用不影响回收
+    while (generation->readers.load(std::memory_order_seq_cst) != 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(PLUGIN_QUIESCE_POLL_INTERVAL));
+    }
+    if (generation->api != nullptr) {
+        generation->api->cleanup();
+    }
+    // 延时等待依赖的so完成清理（如剪贴板回调返回），避免dlclose时crash
+    std::this_thread::sleep_for(std::chrono::milliseconds(CLEANUP_DELAY_TIME));
+    dlclose(generation->handle);
+    SELECTION_HILOGI("Plugin %{public}s unloaded", PLUGIN_SO_PATHS[module]);
+}
+
+void SelectionService::AwaitPluginReclaim(PluginModuleState& plugin, std::unique_lock<std::mutex>& lock)
+{
+    // 在锁外等待后台回收，返回前重新持锁；期间若又有新的卸载，保留其回收状态由调用方继续等待
+    std::shared_future<void> reclaim = plugin.reclaimFuture;
+    lock.unlock();
+    reclaim.wait();
+    lock.lock();
+    if (plugin.reclaimFuture.valid() &&
+        plugin.reclaimFuture.wait_for(std::chrono::milliseconds(0)) == std::future_status::ready) {
+        plugin.reclaimFuture = std::shared_future<void>();
+        plugin.reclaiming = nullptr;
+    }
+}
+
+void SelectionService::WaitPluginSoReclaimed()
+{
+    for (auto& plugin : plugins_) {
+        std::unique_lock<std::mutex> lock(plugin.mutex);
+        while (plugin.reclaimFuture.valid()) {
+            AwaitPluginReclaim(plugin, lock);
+        }
+    }
+}
+
+void SelectionService::UnloadPluginSo()
+{
+    for (uint32_t module = 0; module < PLUGIN_MODULE_COUNT; ++module) {
+        UnloadPluginSo(static_cast<PluginModule>(module));
+    }
+}
+
+void SelectionService::KeepPluginsAlive()
+{
+    // 划词过程中保持已加载的插件；未加载的模块在加载时会重新记录使用时间
+    int64_t now = GetPluginClockMs();
+    for (auto& plugin : plugins_) {
+        plugin.lastUsedMs.store(now, std::memory_order_relaxed);
+    }
+}
 
-        // 延时等待依赖的so完成清理，避免dlclose时crash
-        std::this_thread::sleep_for(std::chrono::milliseconds(CLEANUP_DELAY_TIME));
+int64_t SelectionService::GetPluginClockMs()
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+}
 
-        dlclose(pluginSo_);
-        pluginSo_ = nullptr;
+void SelectionService::StartPluginReaper()
+{
+    std::lock_guard<std::mutex> lock(pluginReaperMutex_);
+    if (pluginReaperTimerId_ != 0) {
+        return;
     }
+    pluginReaperTimerId_ = SelectionFwkTimer::GetInstance()->Register([this]() {
+        OnPluginReaperTick();
+    }, PLUGIN_REAPER_INTERVAL_MS);
+    SELECTION_HILOGI("Plugin reaper started: %{public}u ms", PLUGIN_REAPER_INTERVAL_MS);
+}
 
-    databaseSave_ = nullptr;
-    databaseGet_ = nullptr;
-    databaseAvailable_ = nullptr;
-    abilityConnect_ = nullptr;
-    abilityDisconnect_ = nullptr;
-    abilityAvailable_ = nullptr;
-    pasteboardGetContent_ = nullptr;
-    pasteboardCanGetContent_ = nullptr;
-    pasteboardSetFlag_ = nullptr;
+void SelectionService::StopPluginReaper()
+{
+    std::lock_guard<std::mutex> lock(pluginReaperMutex_);
+    if (pluginReaperTimerId_ != 0) {
+        SelectionFwkTimer::GetInstance()->UnRegister(pluginReaperTimerId_);
+        pluginReaperTimerId_ = 0;
+    }
 }
 
-void SelectionService::ResetPluginUnloadTimer()
+void SelectionService::PrewarmExtAbility()
 {
-    // 取消旧的定时器
-    if (pluginUnloadTimerId_.load() != 0) {
-        SelectionFwkTimer::GetInstance()->UnRegister(pluginUnloadTimerId_.load());
-        pluginUnloadTimerId_.store(0);
+    if (prewarmIdleTimeoutMs_.load() == 0 || !MemSelectionConfig::GetInstance().GetEnable() ||
+        GetScreenLockedFlag()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(connectMutex_);
+        if (connectInner_ != nullptr && connectInner_->connectedAbilityInfo.has_value()) {
+            return;
+        }
+    }
+    std::promise<int32_t> promise;
+    {
+        std::lock_guard<std::mutex> lock(prewarmMutex_);
+        if (prewarmFuture_.valid() &&
+            prewarmFuture_.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return;
+        }
+        prewarmFuture_ = promise.get_future().share();
+        isPrewarmPending_ = true;
     }
+    prewarmStartedCount_.fetch_add(1, std::memory_order_relaxed);
+    ResetPrewarmIdleTimer();
+    SELECTION_HILOGI("Prewarm selection extension connection");
+    // 投机连接：划词开始事件在划词工作线程上执行连接，划词完成事件排在其后，到达时连接已就绪
+    promise.set_value(ConnectExtAbilityFromConfig());
+}
+
+int32_t SelectionService::WaitPrewarmedExtAbility()
+{
+    std::shared_future<int32_t> future;
+    {
+        std::lock_guard<std::mutex> lock(prewarmMutex_);
+        if (isPrewarmPending_) {
+            prewarmUsedCount_.fetch_add(1, std::memory_order_relaxed);
+        }
+        isPrewarmPending_ = false;
+        future = prewarmFuture_;
+    }
+    CancelPrewarmIdleTimer();
+    if (!future.valid()) {
+        return -1;
+    }
+    return future.get();
+}
+
+void SelectionService::ResetPrewarmIdleTimer()
+{
+    CancelPrewarmIdleTimer();
+    std::lock_guard<std::mutex> lock(prewarmMutex_);
+    StartPrewarmIdleTimerLocked();
+}
 
-    // 启动新的定时器：5分钟后自动卸载插件
-    pluginUnloadTimerId_.store(SelectionFwkTimer::GetInstance()->Register([this]() {
-        OnPluginUnloadTimer();
-    }, PLUGIN_UNLOAD_TIMEOUT_MS));
+void SelectionService::StartPrewarmIdleTimerLocked()
+{
+    // 定时器ID在持锁时写入，回调先持锁再读取，保证能与当前登记的ID比较
+    auto timerId = std::make_shared<uint32_t>(0);
+    *timerId = SelectionFwkTimer::GetInstance()->Register([this, timerId]() {
+        OnPrewarmIdleTimer(timerId);
+    }, static_cast<uint32_t>(prewarmIdleTimeoutMs_.load()), true);
+    prewarmIdleTimerId_.store(*timerId);
+}
 
-    SELECTION_HILOGI("Plugin unload timer reset: %{public}d ms", PLUGIN_UNLOAD_TIMEOUT_MS);
+void SelectionService::CancelPrewarmIdleTimer()
+{
+    uint32_t timerId = prewarmIdleTimerId_.exchange(0);
+    if (timerId != 0) {
+        SelectionFwkTimer::GetInstance()->UnRegister(timerId);
+    }
 }
 
-void SelectionService::OnPluginUnloadTimer()
+void SelectionService::OnPrewarmIdleTimer(const std::shared_ptr<uint32_t>& timerId)
 {
-    SELECTION_HILOGI("Plugin unload timer triggered, unloading plugin");
-    // 如果有划词扩展的弹窗在显示，则不断开扩展也不卸载插件
+    {
+        std::lock_guard<std::mutex> lock(prewarmMutex_);
+        // 只清除本定时器自己的ID；已被取消或被新定时器替换时直接返回，不覆盖新登记的ID
+        uint32_t expected = *timerId;
+        if (expected == 0 || !prewarmIdleTimerId_.compare_exchange_strong(expected, 0)) {
+            return;
+        }
+        if (!isPrewarmPending_) {
+            return;
+        }
+        if (prewarmFuture_.valid() && prewarmFuture_.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            // 连接仍在进行，等下一个空闲周期再判断
+            StartPrewarmIdleTimerLocked();
+            return;
+        }
+        isPrewarmPending_ = false;
+    }
     if (IsAnySelectionPanelShowing()) {
-        SELECTION_HILOGI("OnPluginUnloadTimer: Selection panel is showing, keep plugin and extension");
         return;
     }
-    // 先断开扩展应用连接（如果存在），避免插件卸载后无法断开连接
-    if (HasExtAbilityConnection()) {
-        SELECTION_HILOGI("Disconnecting extension ability before unloading plugin");
-        DisconnectCurrentExtAbility();
+    SELECTION_HILOGI("Prewarmed extension connection is not used, disconnect it");
+    prewarmCancelledCount_.fetch_add(1, std::memory_order_relaxed);
+    DisconnectCurrentExtAbility();
+}
+
+void SelectionService::OnPluginReaperTick()
+{
+    int64_t now = GetPluginClockMs();
+    for (uint32_t module = 0; module < PLUGIN_MODULE_COUNT; ++module) {
+        auto& plugin = plugins_[module];
+        if (plugin.Current() == nullptr ||
+            now - plugin.lastUsedMs.load(std::memory_order_relaxed) < PLUGIN_UNLOAD_TIMEOUT_MS) {
+            continue;
+        }
+        // 如果有划词扩展的弹窗在显示，则不断开扩展也不卸载插件，等待下一次巡检
+        if (IsAnySelectionPanelShowing()) {
+            SELECTION_HILOGI("OnPluginReaperTick: Selection panel is showing, keep plugin and extension");
+            return;
+        }
+        SELECTION_HILOGI("Plugin %{public}s idle, unloading", PLUGIN_MODULE_NAMES[module]);
+        // 卸载能力管理插件前先断开扩展应用连接（如果存在），避免插件卸载后无法断开连接
+        if (module == PLUGIN_ABILITY_MANAGER && HasExtAbilityConnection()) {
+            SELECTION_HILOGI("Disconnecting extension ability before unloading plugin");
+            DisconnectCurrentExtAbility();
+        }
+        UnloadPluginSo(static_cast<PluginModule>(module));
+    }
+
+    // 全部插件都已卸载时停止巡检；与加载路径共用 pluginReaperMutex_，加载后必然重新启动巡检
+    std::lock_guard<std::mutex> lock(pluginReaperMutex_);
+    for (const auto& plugin : plugins_) {
+        if (plugin.Current() != nullptr) {
+            return;
+        }
+    }
+    if (pluginReaperTimerId_ != 0) {
+        SelectionFwkTimer::GetInstance()->UnRegister(pluginReaperTimerId_);
+        pluginReaperTimerId_ = 0;
+        SELECTION_HILOGI("All plugins unloaded, plugin reaper stopped");
     }
-    UnloadPluginSo();
-    // pluginUnloadTimerId_ is already set to 0 inside UnloadPluginSo()
 }
 
 int SelectionService::GetDatabaseConfig(int32_t uid, SelectionConfig& config)
 {
-    if (!LoadPluginSo()) {
+    auto api = AcquirePluginApi(PLUGIN_DATABASE);
+    if (!api) {
         SELECTION_HILOGE("Database plugin not available");
         return SELECTION_CONFIG_RDB_NO_INIT;
     }
- 
-    std::shared_lock<std::shared_mutex> readLock(pluginMutex_);
-    if (!pluginSo_ || !databaseGet_) {
-        SELECTION_HILOGE("Database plugin not available after load");
-        return SELECTION_CONFIG_RDB_NO_INIT;
-    }
 
-    SelectionConfig* configPtr = &config;
-    int ret = databaseGet_(uid, configPtr);
+    int ret = api->databaseGetConfig(uid, &config);
     if (ret != 0) {
         SELECTION_HILOGE("DatabaseGetConfig failed, ret=%{public}d", ret);
     }
@@ -1113,18 +1471,13 @@ int SelectionService::GetDatabaseConfig(int32_t uid, SelectionConfig& config)
 
 int SelectionService::SaveDatabaseConfig(int32_t uid, const SelectionConfig& config)
 {
-    if (!LoadPluginSo()) {
+    auto api = AcquirePluginApi(PLUGIN_DATABASE);
+    if (!api) {
         SELECTION_HILOGE("Database plugin not available");
         return SELECTION_CONFIG_RDB_NO_INIT;
     }
- 
-    std::shared_lock<std::shared_mutex> readLock(pluginMutex_);
-    if (!pluginSo_ || !databaseSave_) {
-        SELECTION_HILOGE("Database plugin not available after load");
-        return SELECTION_CONFIG_RDB_NO_INIT;
-    }
 
-    int ret = databaseSave_(uid, &config);
+    int ret = api->databaseSaveConfig(uid, &config);
     if (ret != 0) {
         SELECTION_HILOGE("DatabaseSaveConfig failed, ret=%{public}d", ret);
     }
@@ -1133,61 +1486,159 @@ int SelectionService::SaveDatabaseConfig(int32_t uid, const SelectionConfig& con
 
 bool SelectionService::IsDatabaseAvailable()
 {
-    if (!LoadPluginSo()) {
-        return false;
+    auto api = AcquirePluginApi(PLUGIN_DATABASE);
+    return api && api->databaseIsAvailable() != 0;
+}
+
+void SelectionService::PrefetchSelectionContent(uint32_t seqId, uint32_t windowId, const std::string& bundleName,
+    const SelectionPluginPoint& point)
+{
+    if (!contentPrefetchEnabled_.load()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(prefetchMutex_);
+    if (prefetchStopping_) {
+        return;
     }
-    std::shared_lock<std::shared_mutex> readLock(pluginMutex_);
-    if (!pluginSo_ || !databaseAvailable_) {
+    if (prefetchFuture_.valid() && prefetchFuture_.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        // 剪贴板取词不支持并发，上一次预取未完成时放弃本次预取
+        return;
+    }
+    prefetchPromise_ = std::promise<PrefetchResult>();
+    prefetchSeqId_ = seqId;
+    prefetchFuture_ = prefetchPromise_.get_future().share();
+    prefetchWindowId_ = windowId;
+    prefetchBundleName_ = bundleName;
+    prefetchPoint_ = point;
+    prefetchQueued_ = true;
+    prefetchStartedCount_.fetch_add(1, std::memory_order_relaxed);
+    if (!prefetchWorker_.joinable()) {
+        // 首次预取时才创建常驻线程，未开启预取时不占用线程
+        prefetchWorker_ = std::thread([this]() { RunPrefetchWorker(); });
+    }
+    prefetchCv_.notify_one();
+    SELECTION_HILOGI("Prefetch selection content, seqId: %{public}u", seqId);
+}
+
+void SelectionService::RunPrefetchWorker()
+{
+    pthread_setname_np(pthread_self(), "OS_SelectionPre");
+    std::unique_lock<std::mutex> lock(prefetchMutex_);
+    while (true) {
+        prefetchCv_.wait(lock, [this]() { return prefetchStopping_ || prefetchQueued_; });
+        if (prefetchStopping_) {
+            break;
+        }
+        prefetchQueued_ = false;
+        std::promise<PrefetchResult> promise = std::move(prefetchPromise_);
+        uint32_t windowId = prefetchWindowId_;
+        std::string bundleName = std::move(prefetchBundleName_);
+        SelectionPluginPoint point = prefetchPoint_;
+        lock.unlock();
+        std::string content;
+        int32_t ret = GetPasteboardContent(content, windowId, bundleName, &point);
+        promise.set_value(std::make_pair(ret, std::move(content)));
+        lock.lock();
+    }
+}
+
+void SelectionService::StopPrefetchWorker()
+{
+    {
+        std::lock_guard<std::mutex> lock(prefetchMutex_);
+        prefetchStopping_ = true;
+        prefetchCv_.notify_all();
+    }
+    if (prefetchWorker_.joinable()) {
+        prefetchWorker_.join();
+    }
+    std::lock_guard<std::mutex> lock(prefetchMutex_);
+    if (prefetchQueued_) {
+        // 线程退出前未执行的预取以失败结束，避免取词方一直等待
+        prefetchQueued_ = false;
+        prefetchPromise_.set_value(std::make_pair(SelectionServiceError::INVALID_DATA, std::string()));
+    }
+    prefetchStopping_ = false;
+}
+
+bool SelectionService::TakePrefetchedContent(uint32_t seqId, std::string& content, int32_t& result)
+{
+    std::shared_future<PrefetchResult> future;
+    bool matched = false;
+    {
+        std::lock_guard<std::mutex> lock(prefetchMutex_);
+        future = prefetchFuture_;
+        matched = future.valid() && prefetchSeqId_ == seqId;
+        if (matched) {
+            prefetchFuture_ = std::shared_future<PrefetchResult>();
+        }
+    }
+    if (!matched) {
+        if (future.valid()) {
+            // 等待在途的预取结束后再直接取词，避免两次取词同时占用剪贴板
+            prefetchMissCount_.fetch_add(1, std::memory_order_relaxed);
+            future.wait();
+        }
         return false;
     }
-    return databaseAvailable_() != 0;
+    prefetchHitCount_.fetch_add(1, std::memory_order_relaxed);
+    const PrefetchResult& prefetched = future.get();
+    result = prefetched.first;
+    content = prefetched.second;
+    return true;
 }
 
-int SelectionService::GetPasteboardContent(std::string& content, uint32_t windowId, const std::string& bundleName)
+int SelectionService::GetPasteboardContent(std::string& content, uint32_t windowId, const std::string& bundleName,
+    const SelectionPluginPoint* point)
 {
     constexpr uint32_t MAX_PASTERBOARD_TEXT_LENGTH = 2000;
     constexpr uint32_t BYTES_PER_CHINESE_CHAR = 3;
     constexpr uint32_t bufferSize = MAX_PASTERBOARD_TEXT_LENGTH * BYTES_PER_CHINESE_CHAR + 1;
 
-    if (!LoadPluginSo()) {
+    auto api = AcquirePluginApi(PLUGIN_PASTEBOARD);
+    if (!api) {
         SELECTION_HILOGE("Pasteboard plugin not available");
         return SelectionServiceError::INVALID_DATA;
     }
- 
-    std::shared_lock<std::shared_mutex> readLock(pluginMutex_);
-    if (!pluginSo_ || !pasteboardGetContent_) {
-        SELECTION_HILOGE("Pasteboard plugin not available after load");
-        return SelectionServiceError::INVALID_DATA;
-    }
 
     char buffer[bufferSize] = {0};
-    int ret = pasteboardGetContent_(buffer, bufferSize, windowId, bundleName.c_str());
+    // 按坐标取词为可选能力，插件未提供时退回按窗口取词
+    bool withPoint = point != nullptr && (api->capabilities & SELECTION_PLUGIN_CAP_PASTEBOARD_POINT) != 0 &&
+        api->pasteboardGetContentAt != nullptr;
+    int ret = withPoint ? api->pasteboardGetContentAt(buffer, bufferSize, windowId, bundleName.c_str(), point) :
+        api->pasteboardGetContent(buffer, bufferSize, windowId, bundleName.c_str());
     if (ret == 0) {
         content = buffer;
     }
     return ret;
 }
 
-bool SelectionService::CanGetPasteboardContent()
+int SelectionService::GetPasteboardContentFd(int32_t& contentFd, uint32_t windowId, const std::string& bundleName,
+    const SelectionPluginPoint* point)
 {
-    if (!LoadPluginSo()) {
-        return false;
+    contentFd = -1;
+    auto api = AcquirePluginApi(PLUGIN_PASTEBOARD);
+    if (!api) {
+        SELECTION_HILOGE("Pasteboard plugin not available");
+        return SelectionServiceError::INVALID_DATA;
     }
-    std::shared_lock<std::shared_mutex> readLock(pluginMutex_);
-    if (!pluginSo_ || !pasteboardCanGetContent_) {
-        return false;
+    if (point != nullptr && (api->capabilities & SELECTION_PLUGIN_CAP_PASTEBOARD_POINT) != 0 &&
+        api->pasteboardGetContentFdAt != nullptr) {
+        return api->pasteboardGetContentFdAt(&contentFd, windowId, bundleName.c_str(), point);
     }
-    bool result = pasteboardCanGetContent_() != 0;
-    return result;
+    return api->pasteboardGetContentFd(&contentFd, windowId, bundleName.c_str());
+}
+
+bool SelectionService::CanGetPasteboardContent()
+{
+    auto api = AcquirePluginApi(PLUGIN_PASTEBOARD);
+    return api && api->pasteboardCanGetContent() != 0;
 }
 
 void SelectionService::SetPasteboardFlag(bool flag)
 {
-    if (!LoadPluginSo()) {
-        return;
-    }
-    std::shared_lock<std::shared_mutex> readLock(pluginMutex_);
-    if (pluginSo_ && pasteboardSetFlag_) {
-        pasteboardSetFlag_(flag ? 1 : 0);
+    auto api = AcquirePluginApi(PLUGIN_PASTEBOARD);
+    if (api) {
+        api->pasteboardSetFlag(flag ? 1 : 0);
     }
 }
\ No newline at end of file
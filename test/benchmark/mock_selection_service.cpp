@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// 回放基准只驱动 BaseSelectionInputMonitor，这里提供 SelectionService 的空实现以避免拉起系统服务
+#include "selection_service.h"
+
+namespace OHOS::SelectionFwk {
+sptr<SelectionService> SelectionService::GetInstance()
+{
+    return nullptr;
+}
+
+bool SelectionService::HasExtAbilityConnection() const
+{
+    return false;
+}
+
+int SelectionService::ConnectExtAbilityFromConfig()
+{
+    return 0;
+}
+
+void SelectionService::KeepPluginsAlive()
+{
+}
+
+void SelectionService::PrewarmExtAbility()
+{
+}
+
+int32_t SelectionService::WaitPrewarmedExtAbility()
+{
+    return 0;
+}
+
+bool SelectionService::GetScreenLockedFlag()
+{
+    return false;
+}
+
+sptr<ISelectionListener> SelectionService::GetListener()
+{
+    return nullptr;
+}
+
+bool SelectionService::HasListener(uint32_t eventMask) const
+{
+    return false;
+}
+
+void SelectionService::PrefetchSelectionContent(uint32_t seqId, uint32_t windowId, const std::string& bundleName,
+    const SelectionPluginPoint& point)
+{
+}
+
+bool SelectionService::TakePrefetchedContent(uint32_t seqId, std::string& content, int32_t& result)
+{
+    return false;
+}
+
+void SelectionService::NotifyFocusChange(const SelectionFocusChangeInfo& focusChangeInfo)
+{
+}
+
+ErrCode SelectionService::NotifySelection(const SelectionInfo& selectionInfo)
+{
+    return NO_ERROR;
+}
+
+int SelectionService::GetPasteboardContent(std::string& content, uint32_t windowId, const std::string& bundleName,
+    const SelectionPluginPoint* point)
+{
+    return 0;
+}
+
+int SelectionService::GetPasteboardContentFd(int32_t& contentFd, uint32_t windowId, const std::string& bundleName,
+    const SelectionPluginPoint* point)
+{
+    contentFd = -1;
+    return 0;
+}
+
+bool SelectionService::CanGetPasteboardContent()
+{
+    return false;
+}
+
+void SelectionService::SetPasteboardFlag(bool flag)
+{
+}
+} // namespace OHOS::SelectionFwk
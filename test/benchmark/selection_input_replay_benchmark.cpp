@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "selection_config.h"
+#include "selection_input_monitor.h"
+#include "selection_input_trace.h"
+
+namespace OHOS {
+namespace SelectionFwk {
+using namespace testing::ext;
+
+namespace {
+constexpr const char *TRACE_PATH_ENV = "SELECTION_INPUT_TRACE";
+constexpr int64_t HOVER_INTERVAL_US = 1000;       // 1000Hz 鼠标回报间隔
+constexpr int64_t CLICK_INTERVAL_US = 100000;     // 双击、三击之间的间隔
+constexpr int64_t IDLE_INTERVAL_US = 800000;      // 两轮操作之间的空闲间隔
+constexpr int32_t HOVER_EVENTS_PER_ROUND = 500;
+constexpr int32_t DRAG_EVENTS_PER_ROUND = 50;
+constexpr int64_t TOUCH_INTERVAL_US = 8000;       // 120Hz 触摸屏回报间隔
+constexpr int32_t TOUCH_HOLD_EVENTS = 75;         // 按住约 600ms 触发长按
+constexpr int32_t SYNTHETIC_ROUNDS = 200;
+constexpr uint64_t SELECTIONS_PER_ROUND = 5;
+constexpr int32_t TRACE_WINDOW_ID = 10;
+constexpr int32_t TRACE_DISPLAY_ID = 0;
+constexpr int32_t TRACE_DEVICE_ID = 1;
+constexpr int32_t TRACE_TOUCH_DEVICE_ID = 2;
+constexpr int32_t TOUCH_DRAG_STEP = 2;
+constexpr double PERCENTILE_50 = 0.5;
+constexpr double PERCENTILE_99 = 0.99;
+constexpr double NS_PER_SEC = 1e9;
+constexpr const char *TEST_TRACE_PATH = "/data/local/tmp/selection_input_test.trace";
+
+struct ReplayEvent {
+    std::shared_ptr<PointerEvent> pointerEvent;
+    std::shared_ptr<KeyEvent> keyEvent;
+};
+
+struct ReplayResult {
+    uint64_t events = 0;
+    uint64_t selections = 0;
+    double eventsPerSec = 0;
+    int64_t p50Ns = 0;
+    int64_t p99Ns = 0;
+};
+
+class SyntheticTraceBuilder {
+public:
+    std::vector<InputTraceRecord> Build()
+    {
+        for (int32_t round = 0; round < SYNTHETIC_ROUNDS; ++round) {
+            AddHover(HOVER_EVENTS_PER_ROUND);
+            AddDragSelection();
+            Idle();
+            AddClicks(2);
+            Idle();
+            AddClicks(3);
+            Idle();
+            AddTouchLongPressDrag();
+            Idle();
+        }
+        return records_;
+    }
+
+private:
+    void AddPointer(int32_t action, int32_t buttonId, int32_t deviceId = TRACE_DEVICE_ID,
+        int32_t sourceType = PointerEvent::SOURCE_TYPE_MOUSE)
+    {
+        InputTraceRecord record;
+        record.type = InputTraceType::POINTER;
+        record.actionTime = timeUs_;
+        record.action = action;
+        record.code = static_cast<int16_t>(buttonId);
+        record.displayX = x_;
+        record.displayY = y_;
+        record.windowId = TRACE_WINDOW_ID;
+        record.displayId = TRACE_DISPLAY_ID;
+        record.deviceId = deviceId;
+        record.sourceType = static_cast<uint8_t>(sourceType);
+        records_.push_back(record);
+    }
+
+    void AddHover(int32_t count)
+    {
+        for (int32_t i = 0; i < count; ++i) {
+            timeUs_ += HOVER_INTERVAL_US;
+            x_++;
+            AddPointer(PointerEvent::POINTER_ACTION_MOVE, PointerEvent::BUTTON_NONE);
+        }
+    }
+
+    void AddDragSelection()
+    {
+        AddPointer(PointerEvent::POINTER_ACTION_BUTTON_DOWN, PointerEvent::MOUSE_BUTTON_LEFT);
+        for (int32_t i = 0; i < DRAG_EVENTS_PER_ROUND; ++i) {
+            timeUs_ += HOVER_INTERVAL_US;
+            x_++;
+            AddPointer(PointerEvent::POINTER_ACTION_MOVE, PointerEvent::MOUSE_BUTTON_LEFT);
+        }
+        AddPointer(PointerEvent::POINTER_ACTION_BUTTON_UP, PointerEvent::MOUSE_BUTTON_LEFT);
+    }
+
+    void AddClicks(int32_t count)
+    {
+        for (int32_t i = 0; i < count; ++i) {
+            AddPointer(PointerEvent::POINTER_ACTION_BUTTON_DOWN, PointerEvent::MOUSE_BUTTON_LEFT);
+            AddPointer(PointerEvent::POINTER_ACTION_BUTTON_UP, PointerEvent::MOUSE_BUTTON_LEFT);
+            timeUs_ += CLICK_INTERVAL_US;
+        }
+    }
+
+    void AddTouch(int32_t action)
+    {
+        AddPointer(action, PointerEvent::BUTTON_NONE, TRACE_TOUCH_DEVICE_ID, PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
+    }
+
+    void AddTouchLongPressDrag()
+    {
+        AddTouch(PointerEvent::POINTER_ACTION_DOWN);
+        for (int32_t i = 0; i < TOUCH_HOLD_EVENTS; ++i) {
+            timeUs_ += TOUCH_INTERVAL_US;
+            AddTouch(PointerEvent::POINTER_ACTION_MOVE);
+        }
+        for (int32_t i = 0; i < DRAG_EVENTS_PER_ROUND; ++i) {
+            timeUs_ += TOUCH_INTERVAL_US;
+            x_ += TOUCH_DRAG_STEP;
+            AddTouch(PointerEvent::POINTER_ACTION_MOVE);
+        }
+        AddTouch(PointerEvent::POINTER_ACTION_UP);
+    }
+
+    void Idle()
+    {
+        timeUs_ += IDLE_INTERVAL_US;
+    }
+
+    std::vector<InputTraceRecord> records_;
+    int64_t timeUs_ = 0;
+    int32_t x_ = 0;
+    int32_t y_ = 0;
+};
+
+std::vector<InputTraceRecord> LoadTrace()
+{
+    std::vector<InputTraceRecord> records;
+    const char *path = std::getenv(TRACE_PATH_ENV);
+    if (path != nullptr && SelectionInputTraceRecorder::Load(path, records) && !records.empty()) {
+        std::cout << "replay trace file: " << path << std::endl;
+        return records;
+    }
+    std::cout << "replay synthetic trace" << std::endl;
+    return SyntheticTraceBuilder().Build();
+}
+
+std::vector<ReplayEvent> PrepareEvents(const std::vector<InputTraceRecord>& records)
+{
+    std::vector<ReplayEvent> events;
+    events.reserve(records.size());
+    for (const auto& record : records) {
+        ReplayEvent event;
+        if (record.type == InputTraceType::KEY) {
+            event.keyEvent = SelectionInputTraceRecorder::ToKeyEvent(record);
+        } else {
+            event.pointerEvent = SelectionInputTraceRecorder::ToPointerEvent(record);
+        }
+        events.push_back(event);
+    }
+    return events;
+}
+
+int64_t Percentile(std::vector<int64_t>& samples, double ratio)
+{
+    if (samples.empty()) {
+        return 0;
+    }
+    size_t index = std::min(samples.size() - 1, static_cast<size_t>(samples.size() * ratio));
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+ReplayResult Replay(const std::vector<ReplayEvent>& events)
+{
+    auto inputMonitor = std::make_shared<BaseSelectionInputMonitor>();
+    inputMonitor->SetReplayMode(true);
+    ReplayResult result;
+    std::vector<int64_t> samples;
+    samples.reserve(events.size());
+    bool wasTriggered = false;
+
+    auto begin = std::chrono::steady_clock::now();
+    for (const auto& event : events) {
+        auto start = std::chrono::steady_clock::now();
+        if (event.keyEvent != nullptr) {
+            inputMonitor->OnInputEvent(event.keyEvent);
+        } else if (event.pointerEvent != nullptr) {
+            inputMonitor->OnInputEvent(event.pointerEvent);
+        }
+        auto end = std::chrono::steady_clock::now();
+        samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        bool triggered = inputMonitor->IsSelectionTriggered();
+        if (triggered && !wasTriggered) {
+            result.selections++;
+        }
+        wasTriggered = triggered;
+    }
+    auto totalNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin);
+
+    result.events = samples.size();
+    result.eventsPerSec = totalNs.count() == 0 ? 0 : result.events * NS_PER_SEC / totalNs.count();
+    result.p50Ns = Percentile(samples, PERCENTILE_50);
+    result.p99Ns = Percentile(samples, PERCENTILE_99);
+    return result;
+}
+} // namespace
+
+class SelectionInputReplayBenchmark : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void SelectionInputReplayBenchmark::SetUpTestCase()
+{
+    std::cout << "SelectionInputReplayBenchmark SetUpTestCase" << std::endl;
+}
+
+void SelectionInputReplayBenchmark::TearDownTestCase()
+{
+    std::cout << "SelectionInputReplayBenchmark TearDownTestCase" << std::endl;
+}
+
+void SelectionInputReplayBenchmark::SetUp()
+{
+    std::cout << "SelectionInputReplayBenchmark SetUp" << std::endl;
+    MemSelectionConfig::GetInstance().SetTriggered(false);
+}
+
+void SelectionInputReplayBenchmark::TearDown()
+{
+    std::cout << "SelectionInputReplayBenchmark TearDown" << std::endl;
+}
+
+/**
+ * @tc.name: SelectionInputReplay001
+ * @tc.desc: replay input trace through BaseSelectionInputMonitor and report throughput and latency
+ * @tc.type: PERF
+ */
+HWTEST_F(SelectionInputReplayBenchmark, SelectionInputReplay001, TestSize.Level1)
+{
+    std::vector<ReplayEvent> events = PrepareEvents(LoadTrace());
+    ASSERT_FALSE(events.empty());
+
+    ReplayResult result = Replay(events);
+    std::cout << "events: " << result.events << std::endl;
+    std::cout << "events/sec: " << static_cast<uint64_t>(result.eventsPerSec) << std::endl;
+    std::cout << "latency p50: " << result.p50Ns << " ns, p99: " << result.p99Ns << " ns" << std::endl;
+    std::cout << "selections detected: " << result.selections << std::endl;
+    EXPECT_EQ(result.events, events.size());
+    EXPECT_GT(result.selections, 0);
+}
+
+/**
+ * @tc.name: SelectionInputReplay002
+ * @tc.desc: replaying the same trace twice detects the same selections
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionInputReplayBenchmark, SelectionInputReplay002, TestSize.Level0)
+{
+    std::vector<ReplayEvent> events = PrepareEvents(SyntheticTraceBuilder().Build());
+    ReplayResult first = Replay(events);
+    ReplayResult second = Replay(events);
+    EXPECT_EQ(first.selections, second.selections);
+    // 每轮：拖选 1 次、双击 1 次、三击过程中双击和三击各 1 次、触摸长按拖选 1 次
+    EXPECT_EQ(first.selections, static_cast<uint64_t>(SYNTHETIC_ROUNDS) * SELECTIONS_PER_ROUND);
+}
+
+/**
+ * @tc.name: SelectionInputReplay003
+ * @tc.desc: recorded trace can be loaded and converted back to input events
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionInputReplayBenchmark, SelectionInputReplay003, TestSize.Level0)
+{
+    std::vector<InputTraceRecord> records = SyntheticTraceBuilder().Build();
+    std::vector<ReplayEvent> events = PrepareEvents(records);
+    SelectionInputTraceRecorder recorder;
+    ASSERT_TRUE(recorder.Start(TEST_TRACE_PATH));
+    EXPECT_FALSE(recorder.Start(TEST_TRACE_PATH));
+    for (const auto& event : events) {
+        recorder.Record(event.pointerEvent);
+    }
+    recorder.Stop();
+    EXPECT_EQ(recorder.GetRecordCount(), records.size());
+
+    std::vector<InputTraceRecord> loaded;
+    ASSERT_TRUE(SelectionInputTraceRecorder::Load(TEST_TRACE_PATH, loaded));
+    ASSERT_EQ(loaded.size(), records.size());
+    for (size_t i = 0; i < records.size(); ++i) {
+        EXPECT_EQ(loaded[i].actionTime, records[i].actionTime);
+        EXPECT_EQ(loaded[i].action, records[i].action);
+        EXPECT_EQ(loaded[i].code, records[i].code);
+        EXPECT_EQ(loaded[i].displayX, records[i].displayX);
+        EXPECT_EQ(loaded[i].windowId, records[i].windowId);
+    }
+    std::remove(TEST_TRACE_PATH);
+}
+
+/**
+ * @tc.name: SelectionInputReplay004
+ * @tc.desc: key events keep only the Ctrl key codes the state machine inspects
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionInputReplayBenchmark, SelectionInputReplay004, TestSize.Level0)
+{
+    std::shared_ptr<KeyEvent> keyEvent = KeyEvent::Create();
+    ASSERT_NE(keyEvent, nullptr);
+    keyEvent->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
+    keyEvent->SetKeyCode(KeyEvent::KEYCODE_CTRL_LEFT);
+    EXPECT_EQ(SelectionInputTraceRecorder::ToRecord(keyEvent).code, KeyEvent::KEYCODE_CTRL_LEFT);
+    keyEvent->SetKeyCode(KeyEvent::KEYCODE_CTRL_RIGHT);
+    EXPECT_EQ(SelectionInputTraceRecorder::ToRecord(keyEvent).code, KeyEvent::KEYCODE_CTRL_RIGHT);
+    keyEvent->SetKeyCode(KeyEvent::KEYCODE_A);
+    EXPECT_EQ(SelectionInputTraceRecorder::ToRecord(keyEvent).code, INPUT_TRACE_KEYCODE_OTHER);
+    keyEvent->SetKeyCode(KeyEvent::KEYCODE_0);
+    EXPECT_EQ(SelectionInputTraceRecorder::ToRecord(keyEvent).code, INPUT_TRACE_KEYCODE_OTHER);
+}
+} // namespace SelectionFwk
+} // namespace OHOS
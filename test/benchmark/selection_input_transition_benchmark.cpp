@@ -0,0 +1,499 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "selection_config.h"
+#include "selection_input_monitor.h"
+#include "selection_input_trace.h"
+
+namespace OHOS {
+namespace SelectionFwk {
+using namespace testing::ext;
+
+namespace {
+constexpr int64_t HOVER_INTERVAL_US = 1000;       // 1000Hz 鼠标回报间隔
+constexpr int64_t CLICK_INTERVAL_US = 100000;     // 双击、三击之间的间隔
+constexpr int64_t IDLE_INTERVAL_US = 800000;      // 两轮操作之间的空闲间隔
+constexpr int32_t HOVER_EVENTS_PER_ROUND = 500;
+constexpr int32_t DRAG_EVENTS_PER_ROUND = 50;
+constexpr int32_t BENCHMARK_ROUNDS = 200;
+constexpr uint64_t SELECTIONS_PER_ROUND = 4;
+constexpr int32_t TRACE_WINDOW_ID = 10;
+constexpr int32_t TRACE_DISPLAY_ID = 0;
+constexpr int32_t TRACE_DEVICE_ID = 1;
+
+/**
+ * 重构前嵌套 switch 实现的状态机副本，仅作为性能对比基线。
+ * 去掉了日志、序列号生成和 ListWindowInfo 查询，点击间隔改为按事件时间戳计算，
+ * 与回放模式下的 BaseSelectionInputMonitor 保持一致，其余分支与原实现逐条对应。
+ */
+class LegacySelectInputEngine {
+public:
+    void OnInputEvent(const std::shared_ptr<KeyEvent>& keyEvent)
+    {
+        if (curSelectState_ == SelectInputState::SELECT_INPUT_DONE) {
+            if (subSelectState_ != SelectInputSubState::SUB_INITIAL) {
+                curSelectState_ = SelectInputState::SELECT_INPUT_WORD_END;
+                return;
+            }
+            ResetState();
+            return;
+        }
+        if (subSelectState_ != SelectInputSubState::SUB_WAIT_KEY_CTRL_DOWN &&
+            subSelectState_ != SelectInputSubState::SUB_WAIT_KEY_CTRL_UP &&
+            subSelectState_ != SelectInputSubState::SUB_WAIT_BUTTON_OR_CTRL_DOWN) {
+            return;
+        }
+        int32_t keyCode = keyEvent->GetKeyCode();
+        int32_t action = keyEvent->GetKeyAction();
+        if (keyCode != KeyEvent::KEYCODE_CTRL_LEFT && keyCode != KeyEvent::KEYCODE_CTRL_RIGHT) {
+            ResetState();
+            return;
+        }
+        if (action == KeyEvent::KEY_ACTION_DOWN && keyEvent->IsRepeatKey()) {
+            return;
+        }
+        if ((subSelectState_ == SelectInputSubState::SUB_WAIT_KEY_CTRL_DOWN ||
+             subSelectState_ == SelectInputSubState::SUB_WAIT_BUTTON_OR_CTRL_DOWN) &&
+            action == KeyEvent::KEY_ACTION_DOWN) {
+            subSelectState_ = SelectInputSubState::SUB_WAIT_KEY_CTRL_UP;
+            return;
+        }
+        if (subSelectState_ == SelectInputSubState::SUB_WAIT_KEY_CTRL_UP && action == KeyEvent::KEY_ACTION_UP) {
+            if (curSelectState_ == SelectInputState::SELECT_INPUT_WORD_END) {
+                curSelectState_ = SelectInputState::SELECT_INPUT_DONE;
+            }
+            subSelectState_ = SelectInputSubState::SUB_INITIAL;
+        } else {
+            if (action == KeyEvent::KEY_ACTION_UP && keyEvent->IsRepeatKey()) {
+                return;
+            }
+            ResetState();
+        }
+    }
+
+    void OnInputEvent(const std::shared_ptr<PointerEvent>& pointerEvent)
+    {
+        int32_t buttonId = pointerEvent->GetButtonId();
+        int32_t action = pointerEvent->GetPointerAction();
+        if (action == PointerEvent::POINTER_ACTION_ENTER_WINDOW ||
+            action == PointerEvent::POINTER_ACTION_LEAVE_WINDOW) {
+            return;
+        }
+        if (buttonId == PointerEvent::BUTTON_NONE && action == PointerEvent::POINTER_ACTION_MOVE) {
+            if (ProcessMovement(pointerEvent)) {
+                return;
+            }
+        }
+        if (buttonId != PointerEvent::MOUSE_BUTTON_LEFT) {
+            ResetState();
+            return;
+        }
+        switch (curSelectState_) {
+            case SelectInputState::SELECT_INPUT_INITIAL:
+                InputInitialProcess(pointerEvent);
+                break;
+            case SelectInputState::SELECT_INPUT_WORD_BEGIN:
+                InputWordBeginProcess(pointerEvent);
+                break;
+            case SelectInputState::SELECT_INPUT_WAIT_LEFT_MOVE:
+                InputWordLeftMoveProcess(pointerEvent);
+                break;
+            case SelectInputState::SELECT_INPUT_WAIT_DOUBLE_CLICK:
+                InputWordDoubleClickProcess(pointerEvent);
+                break;
+            case SelectInputState::SELECT_INPUT_WORD_END:
+            case SelectInputState::SELECT_INPUT_DONE:
+                InputWordEndProcess(pointerEvent);
+                break;
+            case SelectInputState::SELECT_INPUT_WAIT_TRIPLE_CLICK:
+                InputWordTripleClickProcess(pointerEvent);
+                break;
+            default:
+                break;
+        }
+    }
+
+    bool IsSelectionTriggered() const
+    {
+        return curSelectState_ == SelectInputState::SELECT_INPUT_DONE;
+    }
+
+private:
+    bool ProcessMovement(const std::shared_ptr<PointerEvent>& pointerEvent)
+    {
+        if (subSelectState_ == SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_DOWN &&
+            IsTinyMovement(pointerEvent)) {
+            if (curSelectState_ == SelectInputState::SELECT_INPUT_DONE) {
+                curSelectState_ = SelectInputState::SELECT_INPUT_WAIT_TRIPLE_CLICK;
+            }
+            return true;
+        }
+        if (subSelectState_ == SelectInputSubState::SUB_WAIT_KEY_CTRL_DOWN ||
+            subSelectState_ == SelectInputSubState::SUB_WAIT_KEY_CTRL_UP) {
+            return true;
+        }
+        if (subSelectState_ == SelectInputSubState::SUB_WAIT_BUTTON_OR_CTRL_DOWN) {
+            subSelectState_ = SelectInputSubState::SUB_WAIT_KEY_CTRL_DOWN;
+            return true;
+        }
+        return false;
+    }
+
+    bool IsTinyMovement(const std::shared_ptr<PointerEvent>& pointerEvent) const
+    {
+        PointerEvent::PointerItem pointerItem;
+        pointerEvent->GetPointerItem(pointerEvent->GetPointerId(), pointerItem);
+        return std::abs(selectionInfo_.startDisplayX - pointerItem.GetGlobalX()) <=
+            static_cast<int32_t>(MAX_POSITION_CHANGE_OFFSET) &&
+            std::abs(selectionInfo_.startDisplayY - pointerItem.GetGlobalY()) <=
+            static_cast<int32_t>(MAX_POSITION_CHANGE_OFFSET);
+    }
+
+    bool IsClickTimeout(const std::shared_ptr<PointerEvent>& pointerEvent, uint32_t time)
+    {
+        int64_t curTime = pointerEvent->GetActionTime() / USEC_PER_MSEC;
+        int64_t duration = curTime - lastClickTime_;
+        lastClickTime_ = curTime;
+        return duration > time;
+    }
+
+    void ResetProcess(const std::shared_ptr<PointerEvent>& pointerEvent)
+    {
+        ResetState();
+        OnInputEvent(pointerEvent);
+    }
+
+    void ResetState()
+    {
+        curSelectState_ = SelectInputState::SELECT_INPUT_INITIAL;
+        subSelectState_ = SelectInputSubState::SUB_INITIAL;
+    }
+
+    void SaveSelectionStartInfo(const std::shared_ptr<PointerEvent>& pointerEvent)
+    {
+        PointerEvent::PointerItem pointerItem;
+        pointerEvent->GetPointerItem(pointerEvent->GetPointerId(), pointerItem);
+        selectionInfo_.startDisplayX = pointerItem.GetGlobalX();
+        selectionInfo_.startDisplayY = pointerItem.GetGlobalY();
+        selectionInfo_.endDisplayX = pointerItem.GetGlobalX();
+        selectionInfo_.endDisplayY = pointerItem.GetGlobalY();
+        selectionInfo_.startWindowX = pointerItem.GetWindowX();
+        selectionInfo_.startWindowY = pointerItem.GetWindowY();
+        selectionInfo_.endWindowX = pointerItem.GetWindowX();
+        selectionInfo_.endWindowY = pointerItem.GetWindowY();
+        int32_t displayId = pointerEvent->GetTargetDisplayId();
+        int32_t windowId = pointerEvent->GetTargetWindowId();
+        if (displayId < 0 || windowId < 0) {
+            return;
+        }
+        selectionInfo_.displayId = static_cast<uint32_t>(displayId);
+        selectionInfo_.windowId = static_cast<uint32_t>(windowId);
+    }
+
+    void SaveSelectionEndInfo(const std::shared_ptr<PointerEvent>& pointerEvent)
+    {
+        switch (curSelectState_) {
+            case SelectInputState::SELECT_INPUT_WAIT_LEFT_MOVE:
+                selectionInfo_.selectionType = MOVE_SELECTION;
+                break;
+            case SelectInputState::SELECT_INPUT_WAIT_DOUBLE_CLICK:
+                selectionInfo_.selectionType = DOUBLE_CLICKED_SELECTION;
+                break;
+            case SelectInputState::SELECT_INPUT_WAIT_TRIPLE_CLICK:
+                selectionInfo_.selectionType = TRIPLE_CLICKED_SELECTION;
+                break;
+            default:
+                break;
+        }
+        PointerEvent::PointerItem pointerItem;
+        pointerEvent->GetPointerItem(pointerEvent->GetPointerId(), pointerItem);
+        selectionInfo_.endDisplayX = pointerItem.GetGlobalX();
+        selectionInfo_.endDisplayY = pointerItem.GetGlobalY();
+        selectionInfo_.endWindowX = pointerItem.GetWindowX();
+        selectionInfo_.endWindowY = pointerItem.GetWindowY();
+    }
+
+    void InputInitialProcess(const std::shared_ptr<PointerEvent>& pointerEvent)
+    {
+        if (pointerEvent->GetPointerAction() == PointerEvent::POINTER_ACTION_BUTTON_DOWN &&
+            pointerEvent->GetButtonId() == PointerEvent::MOUSE_BUTTON_LEFT) {
+            curSelectState_ = SelectInputState::SELECT_INPUT_WORD_BEGIN;
+            subSelectState_ = SelectInputSubState::SUB_INITIAL;
+            lastClickTime_ = pointerEvent->GetActionTime() / USEC_PER_MSEC;
+            SaveSelectionStartInfo(pointerEvent);
+        }
+    }
+
+    void InputWordBeginProcess(const std::shared_ptr<PointerEvent>& pointerEvent)
+    {
+        int32_t action = pointerEvent->GetPointerAction();
+        if (action == PointerEvent::POINTER_ACTION_MOVE) {
+            curSelectState_ = SelectInputState::SELECT_INPUT_WAIT_LEFT_MOVE;
+            subSelectState_ = SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_UP;
+        } else if (action == PointerEvent::POINTER_ACTION_BUTTON_UP) {
+            curSelectState_ = SelectInputState::SELECT_INPUT_WAIT_DOUBLE_CLICK;
+            subSelectState_ = SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_DOWN;
+        }
+    }
+
+    void ProcessWordSelection(const std::shared_ptr<PointerEvent>& pointerEvent)
+    {
+        SaveSelectionEndInfo(pointerEvent);
+        bool isDoubleClick = curSelectState_ == SelectInputState::SELECT_INPUT_WAIT_DOUBLE_CLICK;
+        if (MemSelectionConfig::GetInstance().GetTriggered()) {
+            subSelectState_ = isDoubleClick ? SelectInputSubState::SUB_WAIT_BUTTON_OR_CTRL_DOWN :
+                SelectInputSubState::SUB_WAIT_KEY_CTRL_DOWN;
+            curSelectState_ = SelectInputState::SELECT_INPUT_WORD_END;
+        } else {
+            subSelectState_ = isDoubleClick ? SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_DOWN :
+                SelectInputSubState::SUB_INITIAL;
+            curSelectState_ = SelectInputState::SELECT_INPUT_DONE;
+        }
+    }
+
+    void InputWordLeftMoveProcess(const std::shared_ptr<PointerEvent>& pointerEvent)
+    {
+        int32_t action = pointerEvent->GetPointerAction();
+        if (action == PointerEvent::POINTER_ACTION_BUTTON_UP) {
+            ProcessWordSelection(pointerEvent);
+        } else if (action != PointerEvent::POINTER_ACTION_MOVE) {
+            ResetProcess(pointerEvent);
+        }
+    }
+
+    void JudgeTripleClick(const std::shared_ptr<PointerEvent>& pointerEvent)
+    {
+        if (IsClickTimeout(pointerEvent, TRIPLE_CLICK_TIME)) {
+            ResetProcess(pointerEvent);
+            return;
+        }
+        curSelectState_ = SelectInputState::SELECT_INPUT_WAIT_TRIPLE_CLICK;
+        subSelectState_ = SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_UP;
+    }
+
+    void InputWordDoubleClickProcess(const std::shared_ptr<PointerEvent>& pointerEvent)
+    {
+        int32_t action = pointerEvent->GetPointerAction();
+        if (subSelectState_ == SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_DOWN &&
+            action == PointerEvent::POINTER_ACTION_BUTTON_DOWN) {
+            if (IsClickTimeout(pointerEvent, DOUBLE_CLICK_TIME)) {
+                ResetProcess(pointerEvent);
+                return;
+            }
+            subSelectState_ = SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_UP;
+            return;
+        }
+        if (subSelectState_ == SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_UP) {
+            if (action == PointerEvent::POINTER_ACTION_BUTTON_UP) {
+                ProcessWordSelection(pointerEvent);
+            } else if (action == PointerEvent::POINTER_ACTION_MOVE) {
+                curSelectState_ = SelectInputState::SELECT_INPUT_WAIT_LEFT_MOVE;
+            }
+            return;
+        }
+        if (subSelectState_ == SelectInputSubState::SUB_WAIT_BUTTON_OR_CTRL_DOWN &&
+            action == PointerEvent::POINTER_ACTION_BUTTON_DOWN) {
+            JudgeTripleClick(pointerEvent);
+        }
+    }
+
+    void InputWordEndProcess(const std::shared_ptr<PointerEvent>& pointerEvent)
+    {
+        if (pointerEvent->GetPointerAction() != PointerEvent::POINTER_ACTION_BUTTON_DOWN) {
+            ResetState();
+            return;
+        }
+        if (subSelectState_ != SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_DOWN &&
+            subSelectState_ != SelectInputSubState::SUB_WAIT_BUTTON_OR_CTRL_DOWN) {
+            ResetProcess(pointerEvent);
+            return;
+        }
+        JudgeTripleClick(pointerEvent);
+    }
+
+    void InputWordTripleClickProcess(const std::shared_ptr<PointerEvent>& pointerEvent)
+    {
+        int32_t action = pointerEvent->GetPointerAction();
+        if (action == PointerEvent::POINTER_ACTION_BUTTON_DOWN) {
+            if (IsClickTimeout(pointerEvent, TRIPLE_CLICK_TIME)) {
+                ResetProcess(pointerEvent);
+                return;
+            }
+            subSelectState_ = SelectInputSubState::SUB_WAIT_POINTER_ACTION_BUTTON_UP;
+        } else if (action == PointerEvent::POINTER_ACTION_BUTTON_UP) {
+            ProcessWordSelection(pointerEvent);
+        } else if (action == PointerEvent::POINTER_ACTION_MOVE) {
+            curSelectState_ = SelectInputState::SELECT_INPUT_WAIT_LEFT_MOVE;
+        } else {
+            ResetProcess(pointerEvent);
+        }
+    }
+
+    SelectInputState curSelectState_ = SelectInputState::SELECT_INPUT_INITIAL;
+    SelectInputSubState subSelectState_ = SelectInputSubState::SUB_INITIAL;
+    int64_t lastClickTime_ = 0;
+    SelectionInfo selectionInfo_;
+};
+
+// 原实现不区分设备，这里只构造单个鼠标的悬停、拖选、双击和三击序列
+class MouseTraceBuilder {
+public:
+    std::vector<std::shared_ptr<PointerEvent>> Build()
+    {
+        for (int32_t round = 0; round < BENCHMARK_ROUNDS; ++round) {
+            AddHover(HOVER_EVENTS_PER_ROUND);
+            AddDragSelection();
+            Idle();
+            AddClicks(2);
+            Idle();
+            AddClicks(3);
+            Idle();
+        }
+        return events_;
+    }
+
+private:
+    void AddPointer(int32_t action, int32_t buttonId)
+    {
+        InputTraceRecord record;
+        record.type = InputTraceType::POINTER;
+        record.actionTime = timeUs_;
+        record.action = action;
+        record.code = static_cast<int16_t>(buttonId);
+        record.displayX = x_;
+        record.windowId = TRACE_WINDOW_ID;
+        record.displayId = TRACE_DISPLAY_ID;
+        record.deviceId = TRACE_DEVICE_ID;
+        record.sourceType = static_cast<uint8_t>(PointerEvent::SOURCE_TYPE_MOUSE);
+        events_.push_back(SelectionInputTraceRecorder::ToPointerEvent(record));
+    }
+
+    void AddHover(int32_t count)
+    {
+        for (int32_t i = 0; i < count; ++i) {
+            timeUs_ += HOVER_INTERVAL_US;
+            x_++;
+            AddPointer(PointerEvent::POINTER_ACTION_MOVE, PointerEvent::BUTTON_NONE);
+        }
+    }
+
+    void AddDragSelection()
+    {
+        AddPointer(PointerEvent::POINTER_ACTION_BUTTON_DOWN, PointerEvent::MOUSE_BUTTON_LEFT);
+        for (int32_t i = 0; i < DRAG_EVENTS_PER_ROUND; ++i) {
+            timeUs_ += HOVER_INTERVAL_US;
+            x_++;
+            AddPointer(PointerEvent::POINTER_ACTION_MOVE, PointerEvent::MOUSE_BUTTON_LEFT);
+        }
+        AddPointer(PointerEvent::POINTER_ACTION_BUTTON_UP, PointerEvent::MOUSE_BUTTON_LEFT);
+    }
+
+    void AddClicks(int32_t count)
+    {
+        for (int32_t i = 0; i < count; ++i) {
+            AddPointer(PointerEvent::POINTER_ACTION_BUTTON_DOWN, PointerEvent::MOUSE_BUTTON_LEFT);
+            AddPointer(PointerEvent::POINTER_ACTION_BUTTON_UP, PointerEvent::MOUSE_BUTTON_LEFT);
+            timeUs_ += CLICK_INTERVAL_US;
+        }
+    }
+
+    void Idle()
+    {
+        timeUs_ += IDLE_INTERVAL_US;
+    }
+
+    std::vector<std::shared_ptr<PointerEvent>> events_;
+    int64_t timeUs_ = 0;
+    int32_t x_ = 0;
+};
+
+template <typename Engine>
+int64_t Replay(Engine& engine, const std::vector<std::shared_ptr<PointerEvent>>& events, uint64_t& selections)
+{
+    bool wasTriggered = false;
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& event : events) {
+        engine.OnInputEvent(event);
+        bool triggered = engine.IsSelectionTriggered();
+        selections += (triggered && !wasTriggered) ? 1 : 0;
+        wasTriggered = triggered;
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+} // namespace
+
+class SelectionInputTransitionBenchmark : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void SelectionInputTransitionBenchmark::SetUpTestCase()
+{
+    std::cout << "SelectionInputTransitionBenchmark SetUpTestCase" << std::endl;
+}
+
+void SelectionInputTransitionBenchmark::TearDownTestCase()
+{
+    std::cout << "SelectionInputTransitionBenchmark TearDownTestCase" << std::endl;
+}
+
+void SelectionInputTransitionBenchmark::SetUp()
+{
+    std::cout << "SelectionInputTransitionBenchmark SetUp" << std::endl;
+    MemSelectionConfig::GetInstance().SetTriggered(false);
+}
+
+void SelectionInputTransitionBenchmark::TearDown()
+{
+    std::cout << "SelectionInputTransitionBenchmark TearDown" << std::endl;
+}
+
+/**
+ * @tc.name: SelectionInputTransition001
+ * @tc.desc: replay the same mouse trace through the original nested-switch engine and the table-driven monitor
+ * @tc.type: PERF
+ */
+HWTEST_F(SelectionInputTransitionBenchmark, SelectionInputTransition001, TestSize.Level1)
+{
+    std::vector<std::shared_ptr<PointerEvent>> events = MouseTraceBuilder().Build();
+    ASSERT_FALSE(events.empty());
+
+    LegacySelectInputEngine legacyEngine;
+    uint64_t legacySelections = 0;
+    int64_t legacyNs = Replay(legacyEngine, events, legacySelections);
+
+    BaseSelectionInputMonitor inputMonitor;
+    inputMonitor.SetReplayMode(true);
+    uint64_t tableSelections = 0;
+    int64_t tableNs = Replay(inputMonitor, events, tableSelections);
+
+    std::cout << "nested switch: " << static_cast<double>(legacyNs) / events.size() << " ns/event, "
+              << "transition table: " << static_cast<double>(tableNs) / events.size() << " ns/event" << std::endl;
+    // 每轮：拖选 1 次、双击 1 次、三击过程中双击和三击各 1 次
+    EXPECT_EQ(legacySelections, static_cast<uint64_t>(BENCHMARK_ROUNDS) * SELECTIONS_PER_ROUND);
+    EXPECT_EQ(tableSelections, legacySelections);
+}
+} // namespace SelectionFwk
+} // namespace OHOS
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "selection_whitespace.h"
+
+namespace OHOS {
+namespace SelectionFwk {
+using namespace testing::ext;
+
+namespace {
+constexpr size_t SELECTION_TEXT_BYTES = 6000;  // 剪贴板取词长度上限 2000 个汉字
+constexpr int32_t BENCHMARK_ITERATIONS = 2000;
+constexpr double NS_PER_US = 1000.0;
+constexpr uint32_t UTF8_2BYTE_LEN = 2;
+constexpr uint32_t UTF8_3BYTE_LEN = 3;
+constexpr uint32_t UTF8_4BYTE_LEN = 4;
+
+// 改写前的实现：逐字节在字面量中查找，多字节字符先 substr 再查找
+bool LegacyIsAllWhitespace(const std::string &str)
+{
+    static const std::string invisibleChars =
+        " \t\n\r\f\v"
+        "\u00A0\u1680\u180E"
+        "\u2000\u2001\u2002\u2003\u2004\u2005\u2006\u2007\u2008\u2009\u200A"
+        "\u200B\u200C\u200D\u200E\u200F"
+        "\u2028\u2029\u202A\u202B\u202C\u202D\u202E"
+        "\u205F\u2060\u2061\u2062\u2063\u2064"
+        "\u3000\uFEFF";
+
+    for (size_t i = 0; i < str.size();) {
+        if (static_cast<unsigned char>(str[i]) < 0x80) {
+            if (invisibleChars.find(str[i]) == std::string::npos) {
+                return false;
+            }
+            ++i;
+        } else {
+            uint32_t len = 0;
+            if ((str[i] & 0xE0) == 0xC0) {
+                len = UTF8_2BYTE_LEN;
+            } else if ((str[i] & 0xF0) == 0xE0) {
+                len = UTF8_3BYTE_LEN;
+            } else if ((str[i] & 0xF8) == 0xF0) {
+                len = UTF8_4BYTE_LEN;
+            } else {
+                return false;
+            }
+            if (i + len > str.size()) {
+                return false;
+            }
+            std::string utf8Char = str.substr(i, len);
+            if (invisibleChars.find(utf8Char) == std::string::npos) {
+                return false;
+            }
+            i += len;
+        }
+    }
+    return true;
+}
+
+std::string RepeatToSize(const std::string& unit, size_t size)
+{
+    std::string text;
+    while (text.size() + unit.size() <= size) {
+        text += unit;
+    }
+    return text;
+}
+
+template <typename Classifier>
+double MeasureNsPerCall(const std::string& text, Classifier classifier, bool& result)
+{
+    auto begin = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < BENCHMARK_ITERATIONS; ++i) {
+        result = classifier(text);
+    }
+    auto costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin);
+    return static_cast<double>(costNs.count()) / BENCHMARK_ITERATIONS;
+}
+
+struct BenchmarkCase {
+    const char *name;
+    std::string text;
+};
+
+std::vector<BenchmarkCase> BuildCases()
+{
+    return {
+        { "ascii_spaces", RepeatToSize(" \t\n", SELECTION_TEXT_BYTES) },
+        { "ideographic_spaces", RepeatToSize("\u3000\u00A0\u200B", SELECTION_TEXT_BYTES) },
+        { "trailing_visible", RepeatToSize("\u3000\u2002", SELECTION_TEXT_BYTES - 1) + "x" },
+        { "chinese_text", RepeatToSize("\u4E2D\u6587", SELECTION_TEXT_BYTES) },
+    };
+}
+} // namespace
+
+class SelectionWhitespaceBenchmark : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void SelectionWhitespaceBenchmark::SetUpTestCase()
+{
+    std::cout << "SelectionWhitespaceBenchmark SetUpTestCase" << std::endl;
+}
+
+void SelectionWhitespaceBenchmark::TearDownTestCase()
+{
+    std::cout << "SelectionWhitespaceBenchmark TearDownTestCase" << std::endl;
+}
+
+void SelectionWhitespaceBenchmark::SetUp()
+{
+    std::cout << "SelectionWhitespaceBenchmark SetUp" << std::endl;
+}
+
+void SelectionWhitespaceBenchmark::TearDown()
+{
+    std::cout << "SelectionWhitespaceBenchmark TearDown" << std::endl;
+}
+
+/**
+ * @tc.name: SelectionWhitespace001
+ * @tc.desc: compare the table-driven classifier with the previous literal search on 6000-byte selections
+ * @tc.type: PERF
+ */
+HWTEST_F(SelectionWhitespaceBenchmark, SelectionWhitespace001, TestSize.Level1)
+{
+    for (const auto& item : BuildCases()) {
+        bool legacyResult = false;
+        bool tableResult = false;
+        double legacyNs = MeasureNsPerCall(item.text, LegacyIsAllWhitespace, legacyResult);
+        double tableNs = MeasureNsPerCall(item.text, [](const std::string& text) {
+            return IsAllInvisibleText(text);
+        }, tableResult);
+        std::cout << item.name << ": bytes=" << item.text.size() << " legacy=" << legacyNs / NS_PER_US
+            << "us table=" << tableNs / NS_PER_US << "us speedup=" << (tableNs > 0 ? legacyNs / tableNs : 0)
+            << std::endl;
+        EXPECT_EQ(legacyResult, tableResult) << item.name;
+    }
+}
+
+/**
+ * @tc.name: SelectionWhitespace002
+ * @tc.desc: the table-driven classifier agrees with the previous implementation on its character set
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionWhitespaceBenchmark, SelectionWhitespace002, TestSize.Level0)
+{
+    const std::vector<std::string> samples = {
+        "", " ", "\t\r\n\f\v", "\u00A0\u1680\u180E", "\u2000\u200A\u200F", "\u2028\u202E",
+        "\u205F\u2064", "\u3000\uFEFF", "a", " a ", "\u4E2D", "\xC2", "\xE0\xA0", "\x80", "\xFF",
+    };
+    for (const auto& sample : samples) {
+        EXPECT_EQ(IsAllInvisibleText(sample), LegacyIsAllWhitespace(sample));
+    }
+}
+} // namespace SelectionFwk
+} // namespace OHOS
@@ -85,6 +85,29 @@ void TestFocusChange(uint32_t fuzzedUInt32)
 
     listener->FocusChange(selectionFocusChangeInfo);
 }
+
+void TestOnSelectionEvents(int32_t fuzzedInt32, uint32_t fuzzedUInt32)
+{
+    auto remote = GetSelectionSystemAbility();
+    auto listener = iface_cast<ISelectionListener>(remote);
+
+    if (listener == nullptr) {
+        SELECTION_HILOGE("get listener is null");
+        return;
+    }
+    SelectionFocusChangeInfo selectionFocusChangeInfo;
+    selectionFocusChangeInfo.windowId_ = fuzzedInt32;
+    selectionFocusChangeInfo.windowType_ = fuzzedUInt32;
+    SelectionInfo selectionInfo;
+    selectionInfo.startDisplayX = fuzzedInt32;
+    selectionInfo.windowId = fuzzedUInt32;
+
+    SelectionEventBatch eventBatch;
+    eventBatch.events.push_back(SelectionNotifyEvent::FromFocusChange(selectionFocusChangeInfo));
+    eventBatch.events.push_back(SelectionNotifyEvent::FromSelection(selectionInfo));
+    eventBatch.events.push_back(SelectionNotifyEvent::FromPanelState(fuzzedInt32, true));
+    listener->OnSelectionEvents(eventBatch);
+}
 } // namespace SelectionFwk
 } // namespace OHOS
 
@@ -101,6 +124,7 @@ extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
 
     OHOS::SelectionFwk::TestOnSelectionChange(fuzzedString, fuzzedInt32, fuzzedUInt32);
     OHOS::SelectionFwk::TestFocusChange(fuzzedUInt32);
+    OHOS::SelectionFwk::TestOnSelectionEvents(fuzzedInt32, fuzzedUInt32);
 
     return 0;
 }
\ No newline at end of file
@@ -146,5 +146,36 @@ HWTEST_F(FocusMonitorTest, FocusMonitor005, TestSize.Level0)
     listener.OnFocused(focusChangeInfo2);
     listener.OnUnfocused(focusChangeInfo2);
 }
+
+/**
+ * @tc.name: FocusMonitor006
+ * @tc.desc: test focus cache is updated by focus callbacks
+ * @tc.type: FUNC
+ */
+HWTEST_F(FocusMonitorTest, FocusMonitor006, TestSize.Level0)
+{
+    constexpr int32_t focusedWindowId = 100;
+    constexpr int32_t otherWindowId = 200;
+    auto &manager = FocusMonitorManager::GetInstance();
+    sptr<Rosen::FocusChangeInfo> focusChangeInfo = new (std::nothrow) Rosen::FocusChangeInfo();
+    ASSERT_NE(focusChangeInfo, nullptr);
+    focusChangeInfo->windowId_ = focusedWindowId;
+    manager.UpdateFocusCache(focusChangeInfo, true);
+
+    FocusWindowInfo info;
+    EXPECT_TRUE(manager.GetFocusWindowInfo(info));
+    EXPECT_EQ(info.windowId, focusedWindowId);
+
+    focusChangeInfo->windowId_ = otherWindowId;
+    manager.UpdateFocusCache(focusChangeInfo, false);
+    EXPECT_TRUE(manager.GetFocusWindowInfo(info));
+    EXPECT_EQ(info.windowId, focusedWindowId);
+
+    focusChangeInfo->windowId_ = focusedWindowId;
+    manager.UpdateFocusCache(focusChangeInfo, false);
+    EXPECT_FALSE(manager.isFocusCacheValid_);
+    manager.UpdateFocusCache(nullptr, true);
+    EXPECT_FALSE(manager.isFocusCacheValid_);
+}
 }
 }
\ No newline at end of file
@@ -15,8 +15,11 @@
 
 #include "gtest/gtest.h"
 
+#include <unistd.h>
 #include "selection_config.h"
+#include "selection_content_shm.h"
 #include "selection_errors.h"
+#include "selection_plugin_api.h"
 
 namespace OHOS {
 namespace SelectionFwk {
@@ -27,13 +30,14 @@ using SelectionConfig = OHOS::SelectionFwk::SelectionConfig;
 } // namespace SelectionFwk
 } // namespace OHOS
 
-// External C functions from plugin_exports.cpp
+// External C functions from the per-module *_plugin_exports.cpp
 extern "C" {
     int DatabaseSaveConfig(int uid, const OHOS::SelectionFwk::SelectionConfig* config);
     int DatabaseGetConfig(int uid, OHOS::SelectionFwk::SelectionConfig* config);
     int DatabaseIsAvailable();
 
     int PasteboardGetSelectionContent(char* buffer, int bufferSize, uint32_t windowId, const char* bundleName);
+    int PasteboardGetSelectionContentFd(int* fd, uint32_t windowId, const char* bundleName);
     int PasteboardCanGetSelectionContent();
     void PasteboardSetCanGetSelectionContentFlag(int flag);
     int PasteboardIsAvailable();
@@ -42,7 +46,13 @@ extern "C" {
     int AbilityManagerDisconnectAbility(const void* callback);
     int AbilityManagerIsAvailable();
 
-    void PluginCleanupAll();
+    void DatabasePluginCleanup();
+    void PasteboardPluginCleanup();
+    void AbilityManagerPluginCleanup();
+
+    const OHOS::SelectionFwk::SelectionPluginApi* GetDatabasePluginApi(uint32_t version);
+    const OHOS::SelectionFwk::SelectionPluginApi* GetPasteboardPluginApi(uint32_t version);
+    const OHOS::SelectionFwk::SelectionPluginApi* GetAbilityManagerPluginApi(uint32_t version);
 }
 
 namespace OHOS {
@@ -376,7 +386,7 @@ HWTEST_F(PluginExportsTest, PluginExports021, TestSize.Level0)
 
 /**
  * @tc.name: PluginExports022
- * @tc.desc: test PluginCleanupAll
+ * @tc.desc: test DatabasePluginCleanup
  * @tc.type: FUNC
  */
 HWTEST_F(PluginExportsTest, PluginExports022, TestSize.Level0)
@@ -387,7 +397,7 @@ HWTEST_F(PluginExportsTest, PluginExports022, TestSize.Level0)
     DatabaseSaveConfig(4001, &config);
 
     // Cleanup should work without crashing
-    PluginCleanupAll();
+    DatabasePluginCleanup();
 
     // After cleanup, IsAvailable should return false
     int dbAvailable = DatabaseIsAvailable();
@@ -396,12 +406,12 @@ HWTEST_F(PluginExportsTest, PluginExports022, TestSize.Level0)
 
 /**
  * @tc.name: PluginExports024
- * @tc.desc: test Database operations after PluginCleanupAll
+ * @tc.desc: test Database operations after DatabasePluginCleanup
  * @tc.type: FUNC
  */
 HWTEST_F(PluginExportsTest, PluginExports024, TestSize.Level0)
 {
-    PluginCleanupAll();
+    DatabasePluginCleanup();
 
     // After cleanup, operations should still work (plugins auto-reinitialize)
     SelectionConfig config;
@@ -414,12 +424,12 @@ HWTEST_F(PluginExportsTest, PluginExports024, TestSize.Level0)
 
 /**
  * @tc.name: PluginExports025
- * @tc.desc: test Pasteboard operations after PluginCleanupAll
+ * @tc.desc: test Pasteboard operations after PasteboardPluginCleanup
  * @tc.type: FUNC
  */
 HWTEST_F(PluginExportsTest, PluginExports025, TestSize.Level0)
 {
-    PluginCleanupAll();
+    PasteboardPluginCleanup();
 
     // After cleanup, operations should still work (plugins auto-reinitialize)
     PasteboardSetCanGetSelectionContentFlag(1);
@@ -478,5 +488,120 @@ HWTEST_F(PluginExportsTest, PluginExports030, TestSize.Level0)
     ASSERT_EQ(PasteboardCanGetSelectionContent(), 0);
 }
 
+/**
+ * @tc.name: PluginExports031
+ * @tc.desc: test PasteboardGetSelectionContentFd with null fd
+ * @tc.type: FUNC
+ */
+HWTEST_F(PluginExportsTest, PluginExports031, TestSize.Level0)
+{
+    int ret = PasteboardGetSelectionContentFd(nullptr, 0, "test.bundle");
+    ASSERT_EQ(ret, -1);
+}
+
+/**
+ * @tc.name: PluginExports032
+ * @tc.desc: test selection content shared memory round trip and read-only protection
+ * @tc.type: FUNC
+ */
+HWTEST_F(PluginExportsTest, PluginExports032, TestSize.Level0)
+{
+    std::string content(MAX_SELECTION_CONTENT_SHM_LENGTH / 2, 'a');
+    int32_t fd = CreateSelectionContentShm(content);
+    ASSERT_GE(fd, 0);
+    std::string result;
+    EXPECT_TRUE(ReadSelectionContentShm(fd, result));
+    EXPECT_EQ(result, content);
+    EXPECT_EQ(mmap(nullptr, AshmemGetSize(fd), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0), MAP_FAILED);
+    close(fd);
+
+    EXPECT_LT(CreateSelectionContentShm(std::string(MAX_SELECTION_CONTENT_SHM_LENGTH + 1, 'a')), 0);
+    EXPECT_FALSE(ReadSelectionContentShm(-1, result));
+}
+
+/**
+ * @tc.name: PluginExports033
+ * @tc.desc: test cleaning up one plugin module leaves the other modules initialized
+ * @tc.type: FUNC
+ */
+HWTEST_F(PluginExportsTest, PluginExports033, TestSize.Level0)
+{
+    SelectionConfig config;
+    config.SetEnabled(true);
+    ASSERT_EQ(DatabaseSaveConfig(5004, &config), SELECTION_CONFIG_OK);
+    PasteboardSetCanGetSelectionContentFlag(1);
+    ASSERT_EQ(PasteboardIsAvailable(), 1);
+
+    PasteboardPluginCleanup();
+    EXPECT_EQ(PasteboardIsAvailable(), 0);
+    EXPECT_EQ(DatabaseIsAvailable(), 1);
+
+    DatabasePluginCleanup();
+    AbilityManagerPluginCleanup();
+    EXPECT_EQ(DatabaseIsAvailable(), 0);
+    EXPECT_EQ(AbilityManagerIsAvailable(), 0);
+}
+
+/**
+ * @tc.name: PluginExports034
+ * @tc.desc: test each plugin module api table reports its version, size and capabilities
+ * @tc.type: FUNC
+ */
+HWTEST_F(PluginExportsTest, PluginExports034, TestSize.Level0)
+{
+    EXPECT_EQ(GetDatabasePluginApi(0), nullptr);
+    EXPECT_EQ(GetPasteboardPluginApi(SELECTION_PLUGIN_API_VERSION + 1), nullptr);
+    EXPECT_EQ(GetAbilityManagerPluginApi(SELECTION_PLUGIN_API_VERSION + 1), nullptr);
+
+    const SelectionPluginApi* database = GetDatabasePluginApi(SELECTION_PLUGIN_API_VERSION);
+    ASSERT_NE(database, nullptr);
+    EXPECT_EQ(database->abiVersion, SELECTION_PLUGIN_API_VERSION);
+    EXPECT_EQ(database->structSize, sizeof(SelectionPluginApi));
+    EXPECT_EQ(database->capabilities, SELECTION_PLUGIN_CAP_DATABASE);
+    EXPECT_EQ(database->databaseSaveConfig, &DatabaseSaveConfig);
+    EXPECT_EQ(database->cleanup, &DatabasePluginCleanup);
+    EXPECT_EQ(database->pasteboardGetContent, nullptr);
+
+    const SelectionPluginApi* pasteboard = GetPasteboardPluginApi(SELECTION_PLUGIN_API_VERSION);
+    ASSERT_NE(pasteboard, nullptr);
+    EXPECT_EQ(pasteboard->capabilities, SELECTION_PLUGIN_CAP_PASTEBOARD | SELECTION_PLUGIN_CAP_PASTEBOARD_DUMP |
+        SELECTION_PLUGIN_CAP_PASTEBOARD_POINT);
+    EXPECT_NE(pasteboard->pasteboardGetContentAt, nullptr);
+    EXPECT_NE(pasteboard->pasteboardGetContentFdAt, nullptr);
+    EXPECT_EQ(pasteboard->pasteboardCanGetContent, &PasteboardCanGetSelectionContent);
+    EXPECT_EQ(pasteboard->cleanup, &PasteboardPluginCleanup);
+    EXPECT_EQ(pasteboard->databaseSaveConfig, nullptr);
+
+    const SelectionPluginApi* ability = GetAbilityManagerPluginApi(SELECTION_PLUGIN_API_VERSION);
+    ASSERT_NE(ability, nullptr);
+    EXPECT_EQ(ability->capabilities, SELECTION_PLUGIN_CAP_ABILITY_MANAGER);
+    EXPECT_EQ(ability->abilityConnect, &AbilityManagerConnectAbility);
+    EXPECT_EQ(ability->cleanup, &AbilityManagerPluginCleanup);
+}
+
+/**
+ * @tc.name: PluginExports035
+ * @tc.desc: test selection content shared memory is visited through a view over the mapping without copying
+ * @tc.type: FUNC
+ */
+HWTEST_F(PluginExportsTest, PluginExports035, TestSize.Level0)
+{
+    std::string content = "selection content";
+    int32_t fd = CreateSelectionContentShm(content);
+    ASSERT_GE(fd, 0);
+    const char *viewData = nullptr;
+    size_t viewSize = 0;
+    EXPECT_TRUE(VisitSelectionContentShm(fd, [&](std::string_view view) {
+        EXPECT_EQ(view, content);
+        viewData = view.data();
+        viewSize = view.size();
+    }));
+    // The view points into the mapping right after the header instead of a heap copy
+    EXPECT_NE(viewData, content.data());
+    EXPECT_EQ(viewSize, content.size());
+    EXPECT_FALSE(VisitSelectionContentShm(fd, nullptr));
+    close(fd);
+    EXPECT_FALSE(VisitSelectionContentShm(-1, [](std::string_view) {}));
+}
 } // namespace SelectionFwk
 } // namespace OHOS
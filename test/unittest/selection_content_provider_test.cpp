@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "selection_content_provider.h"
+#include "selection_errors.h"
+
+namespace OHOS {
+namespace SelectionFwk {
+using namespace testing::ext;
+
+namespace {
+const std::string TEST_BUNDLE = "com.example.test";
+
+class FakeContentProvider : public SelectionContentProvider {
+public:
+    FakeContentProvider(const std::string& name, int32_t ret, const std::string& content, bool available = true)
+        : name_(name), ret_(ret), content_(content), available_(available) {}
+
+    const char *GetName() const override
+    {
+        return name_.c_str();
+    }
+
+    bool IsAvailable(const SelectionContentQuery& query) const override
+    {
+        return available_;
+    }
+
+    int32_t GetContent(const SelectionContentQuery& query, std::string& content) override
+    {
+        calls_++;
+        content = content_;
+        return ret_;
+    }
+
+    int32_t calls_ = 0;
+
+private:
+    std::string name_;
+    int32_t ret_;
+    std::string content_;
+    bool available_;
+};
+} // namespace
+
+class SelectionContentProviderTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void SelectionContentProviderTest::SetUpTestCase()
+{
+    std::cout << "SelectionContentProviderTest SetUpTestCase" << std::endl;
+}
+
+void SelectionContentProviderTest::TearDownTestCase()
+{
+    std::cout << "SelectionContentProviderTest TearDownTestCase" << std::endl;
+}
+
+void SelectionContentProviderTest::SetUp()
+{
+    std::cout << "SelectionContentProviderTest SetUp" << std::endl;
+}
+
+void SelectionContentProviderTest::TearDown()
+{
+    std::cout << "SelectionContentProviderTest TearDown" << std::endl;
+}
+
+/**
+ * @tc.name: SelectionContentProvider001
+ * @tc.desc: test the provider with the highest priority serves the request
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionContentProviderTest, SelectionContentProvider001, TestSize.Level0)
+{
+    SelectionContentProviderChain chain;
+    auto fallback = std::make_shared<FakeContentProvider>("fallback", ERR_OK, "fallback text");
+    auto direct = std::make_shared<FakeContentProvider>("direct", ERR_OK, "direct text");
+    chain.Register(fallback, SYNTHETIC_COPY_CONTENT_PROVIDER_PRIORITY);
+    chain.Register(direct, ACCESSIBILITY_CONTENT_PROVIDER_PRIORITY);
+
+    SelectionContentQuery query;
+    query.bundleName = TEST_BUNDLE;
+    std::string content;
+    EXPECT_EQ(chain.GetContent(query, content), ERR_OK);
+    EXPECT_EQ(content, "direct text");
+    EXPECT_EQ(direct->calls_, 1);
+    EXPECT_EQ(fallback->calls_, 0);
+
+    auto stats = chain.GetStats();
+    ASSERT_EQ(stats.size(), 2);
+    EXPECT_EQ(stats[0].name, "direct");
+    EXPECT_EQ(stats[0].usage.served, 1);
+    EXPECT_EQ(chain.GetBundleStats(TEST_BUNDLE)["direct"].served, 1);
+}
+
+/**
+ * @tc.name: SelectionContentProvider002
+ * @tc.desc: test failed or unavailable providers fall back to the next provider
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionContentProviderTest, SelectionContentProvider002, TestSize.Level0)
+{
+    SelectionContentProviderChain chain;
+    auto skipped = std::make_shared<FakeContentProvider>("skipped", ERR_OK, "skipped text", false);
+    auto empty = std::make_shared<FakeContentProvider>("empty", ERR_OK, "");
+    auto fallback = std::make_shared<FakeContentProvider>("fallback", ERR_OK, "fallback text");
+    chain.Register(skipped, 1);
+    chain.Register(empty, 2);
+    chain.Register(fallback, 3);
+
+    SelectionContentQuery query;
+    query.bundleName = TEST_BUNDLE;
+    std::string content;
+    EXPECT_EQ(chain.GetContent(query, content), ERR_OK);
+    EXPECT_EQ(content, "fallback text");
+    EXPECT_EQ(skipped->calls_, 0);
+
+    auto bundleStats = chain.GetBundleStats(TEST_BUNDLE);
+    EXPECT_EQ(bundleStats.count("skipped"), 0);
+    EXPECT_EQ(bundleStats["empty"].failed, 1);
+    EXPECT_EQ(bundleStats["fallback"].served, 1);
+}
+
+/**
+ * @tc.name: SelectionContentProvider003
+ * @tc.desc: test the error of the last provider is returned and same name registration replaces
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionContentProviderTest, SelectionContentProvider003, TestSize.Level0)
+{
+    SelectionContentProviderChain chain;
+    SelectionContentQuery query;
+    std::string content;
+    EXPECT_EQ(chain.GetContent(query, content), SelectionServiceError::CANNOT_GET_CONTENT);
+
+    chain.Register(std::make_shared<FakeContentProvider>("copy", ERR_OK, "old"), 1);
+    chain.Register(std::make_shared<FakeContentProvider>("copy",
+        SelectionServiceError::GET_CONTENT_TIMEOUT, ""), 2);
+    ASSERT_EQ(chain.GetStats().size(), 1);
+    EXPECT_EQ(chain.GetContent(query, content), SelectionServiceError::GET_CONTENT_TIMEOUT);
+    EXPECT_TRUE(content.empty());
+
+    chain.Unregister("copy");
+    EXPECT_TRUE(chain.GetStats().empty());
+}
+
+/**
+ * @tc.name: SelectionContentProvider004
+ * @tc.desc: test selection offsets are counted in UTF-16 code units
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionContentProviderTest, SelectionContentProvider004, TestSize.Level0)
+{
+    // "a" + U+4E2D (one unit) + U+1F600 (surrogate pair) + "b"
+    const std::string text = "a\xE4\xB8\xAD\xF0\x9F\x98\x80" "b";
+    std::string result;
+    EXPECT_TRUE(Utf8SubstrByUtf16Range(text, 1, 1, result));
+    EXPECT_EQ(result, "\xE4\xB8\xAD");
+    EXPECT_TRUE(Utf8SubstrByUtf16Range(text, 2, 2, result));
+    EXPECT_EQ(result, "\xF0\x9F\x98\x80");
+    EXPECT_TRUE(Utf8SubstrByUtf16Range(text, 4, 1, result));
+    EXPECT_EQ(result, "b");
+    EXPECT_TRUE(Utf8SubstrByUtf16Range(text, 0, 5, result));
+    EXPECT_EQ(result, text);
+
+    // Boundaries inside the surrogate pair, empty and out-of-range selections are rejected
+    EXPECT_FALSE(Utf8SubstrByUtf16Range(text, 2, 1, result));
+    EXPECT_FALSE(Utf8SubstrByUtf16Range(text, 3, 2, result));
+    EXPECT_FALSE(Utf8SubstrByUtf16Range(text, 1, 0, result));
+    EXPECT_FALSE(Utf8SubstrByUtf16Range(text, 4, 2, result));
+    EXPECT_FALSE(Utf8SubstrByUtf16Range(text, 6, 1, result));
+}
+} // namespace SelectionFwk
+} // namespace OHOS
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "selection_content_session.h"
+#include "selection_content_shm.h"
+#include "selection_errors.h"
+
+namespace OHOS {
+namespace SelectionFwk {
+using namespace testing::ext;
+
+namespace {
+constexpr int32_t TEST_PID = 1000;
+} // namespace
+
+class SelectionContentSessionTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void SelectionContentSessionTest::SetUpTestCase()
+{
+    std::cout << "SelectionContentSessionTest SetUpTestCase" << std::endl;
+}
+
+void SelectionContentSessionTest::TearDownTestCase()
+{
+    std::cout << "SelectionContentSessionTest TearDownTestCase" << std::endl;
+}
+
+void SelectionContentSessionTest::SetUp()
+{
+    std::cout << "SelectionContentSessionTest SetUp" << std::endl;
+}
+
+void SelectionContentSessionTest::TearDown()
+{
+    std::cout << "SelectionContentSessionTest TearDown" << std::endl;
+}
+
+/**
+ * @tc.name: SelectionContentSession001
+ * @tc.desc: test chunk length never splits a multi-byte UTF-8 character
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionContentSessionTest, SelectionContentSession001, TestSize.Level0)
+{
+    std::string text = "a中文b"; // 1 + 3 + 3 + 1 字节
+    EXPECT_EQ(SelectionContentSession::Utf8ChunkLength(text.data(), text.size(), 100), text.size());
+    EXPECT_EQ(SelectionContentSession::Utf8ChunkLength(text.data(), text.size(), 1), 1);
+    EXPECT_EQ(SelectionContentSession::Utf8ChunkLength(text.data(), text.size(), 2), 1);
+    EXPECT_EQ(SelectionContentSession::Utf8ChunkLength(text.data(), text.size(), 4), 4);
+    EXPECT_EQ(SelectionContentSession::Utf8ChunkLength(text.data() + 1, text.size() - 1, 2), 0);
+    EXPECT_EQ(SelectionContentSession::Utf8ChunkLength(nullptr, 1, 1), 0);
+}
+
+/**
+ * @tc.name: SelectionContentSession002
+ * @tc.desc: test reading a shared memory content session chunk by chunk
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionContentSessionTest, SelectionContentSession002, TestSize.Level0)
+{
+    std::string text;
+    for (int32_t i = 0; i < 1000; ++i) {
+        text += "选中word ";
+    }
+    SelectionContentSession session;
+    uint32_t length = 0;
+    ASSERT_EQ(session.Open(CreateSelectionContentShm(text), TEST_PID, length), 0);
+    EXPECT_EQ(length, text.size());
+
+    std::string result;
+    std::string chunk;
+    uint32_t offset = 0;
+    while (offset < length) {
+        ASSERT_EQ(session.Read(TEST_PID, offset, 100, chunk), 0);
+        ASSERT_FALSE(chunk.empty());
+        EXPECT_LE(chunk.size(), 100);
+        result += chunk;
+        offset += chunk.size();
+    }
+    EXPECT_EQ(result, text);
+    EXPECT_EQ(session.Read(TEST_PID, length, 100, chunk), 0);
+    EXPECT_TRUE(chunk.empty());
+    EXPECT_EQ(session.Read(TEST_PID, length + 1, 100, chunk), SelectionServiceError::CONTENT_OUT_OF_RANGE);
+    EXPECT_EQ(session.Read(TEST_PID, 1, 100, chunk), SelectionServiceError::INVALID_DATA);
+    EXPECT_EQ(session.Read(TEST_PID + 1, 0, 100, chunk), SelectionServiceError::INVALID_TIMING);
+
+    session.Close(TEST_PID + 1);
+    EXPECT_TRUE(session.IsOpen());
+    session.Close(TEST_PID);
+    EXPECT_FALSE(session.IsOpen());
+    EXPECT_EQ(session.Read(TEST_PID, 0, 100, chunk), SelectionServiceError::INVALID_TIMING);
+}
+} // namespace SelectionFwk
+} // namespace OHOS
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "selection_event_worker.h"
+
+namespace OHOS {
+namespace SelectionFwk {
+using namespace testing::ext;
+
+namespace {
+constexpr uint32_t WORKER_EVENT_COUNT = 1000;
+constexpr int32_t WAIT_WORKER_TIMEOUT_MS = 2000;
+} // namespace
+
+class SelectionEventWorkerTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void SelectionEventWorkerTest::SetUpTestCase()
+{
+    std::cout << "SelectionEventWorkerTest SetUpTestCase" << std::endl;
+}
+
+void SelectionEventWorkerTest::TearDownTestCase()
+{
+    std::cout << "SelectionEventWorkerTest TearDownTestCase" << std::endl;
+}
+
+void SelectionEventWorkerTest::SetUp()
+{
+    std::cout << "SelectionEventWorkerTest SetUp" << std::endl;
+}
+
+void SelectionEventWorkerTest::TearDown()
+{
+    std::cout << "SelectionEventWorkerTest TearDown" << std::endl;
+}
+
+/**
+ * @tc.name: SelectionEventWorker001
+ * @tc.desc: test SpscRingBuffer push and pop boundary
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionEventWorkerTest, SelectionEventWorker001, TestSize.Level0)
+{
+    SpscRingBuffer<uint32_t, 4> ring;
+    uint32_t value = 0;
+    EXPECT_FALSE(ring.TryPop(value));
+    for (uint32_t i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ring.TryPush(i));
+    }
+    EXPECT_FALSE(ring.TryPush(4));
+    EXPECT_EQ(ring.Size(), 4);
+    for (uint32_t i = 0; i < 4; ++i) {
+        ASSERT_TRUE(ring.TryPop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_TRUE(ring.Empty());
+}
+
+/**
+ * @tc.name: SelectionEventWorker002
+ * @tc.desc: test SelectionEventRecord keeps selection info and leaves the bundle name to the worker
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionEventWorkerTest, SelectionEventWorker002, TestSize.Level0)
+{
+    SelectionInfo info;
+    info.selectionType = DOUBLE_CLICKED_SELECTION;
+    info.startDisplayX = 1;
+    info.endWindowY = 2;
+    info.windowId = 3;
+    info.bundleName = "com.example.selection";
+    SelectionEventRecord record;
+    record.FromSelectionInfo(info);
+    SelectionInfo result = record.ToSelectionInfo();
+    EXPECT_EQ(result.selectionType, DOUBLE_CLICKED_SELECTION);
+    EXPECT_EQ(result.startDisplayX, 1);
+    EXPECT_EQ(result.endWindowY, 2);
+    EXPECT_EQ(result.windowId, 3);
+    EXPECT_TRUE(result.bundleName.empty());
+}
+
+/**
+ * @tc.name: SelectionEventWorker003
+ * @tc.desc: test worker consumes posted events in order and records queue latency
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionEventWorkerTest, SelectionEventWorker003, TestSize.Level0)
+{
+    SelectionEventWorker worker;
+    std::atomic<uint32_t> handled = 0;
+    std::atomic<bool> inOrder = true;
+    uint32_t lastSeqId = 0;
+    worker.Start([&](const SelectionEventRecord& record) {
+        if (record.seqId != lastSeqId + 1) {
+            inOrder = false;
+        }
+        lastSeqId = record.seqId;
+        handled++;
+    });
+
+    uint32_t posted = 0;
+    for (uint32_t i = 0; i < WORKER_EVENT_COUNT; ++i) {
+        SelectionEventRecord record;
+        record.seqId = posted + 1;
+        if (worker.Post(record)) {
+            posted++;
+        }
+    }
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(WAIT_WORKER_TIMEOUT_MS);
+    while (handled.load() < posted && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    worker.Stop();
+
+    EXPECT_EQ(handled.load(), posted);
+    EXPECT_TRUE(inOrder.load());
+    SelectionWorkerStats stats = worker.GetStats();
+    EXPECT_EQ(stats.dropped, WORKER_EVENT_COUNT - posted);
+    EXPECT_LE(stats.maxQueueDepth, SELECTION_EVENT_QUEUE_CAPACITY);
+    EXPECT_EQ(stats.stages[static_cast<size_t>(SelectionStage::QUEUE_WAIT)].count, posted);
+}
+
+/**
+ * @tc.name: SelectionEventWorker004
+ * @tc.desc: test MpscRingBuffer keeps every item pushed by concurrent producers exactly once
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionEventWorkerTest, SelectionEventWorker004, TestSize.Level0)
+{
+    constexpr uint32_t producerCount = 4;
+    constexpr uint32_t itemsPerProducer = 1000;
+    MpscRingBuffer<uint32_t, 8> ring;
+    uint32_t value = 0;
+    EXPECT_TRUE(ring.Empty());
+    EXPECT_FALSE(ring.TryPop(value));
+
+    std::vector<std::thread> producers;
+    for (uint32_t producer = 0; producer < producerCount; ++producer) {
+        producers.emplace_back([&ring, producer]() {
+            for (uint32_t i = 0; i < itemsPerProducer; ++i) {
+                while (!ring.TryPush(producer * itemsPerProducer + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    // Items from one producer must stay in order and every item is consumed once
+    std::vector<uint32_t> nextIndex(producerCount, 0);
+    uint32_t consumed = 0;
+    bool inOrder = true;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(WAIT_WORKER_TIMEOUT_MS);
+    while (consumed < producerCount * itemsPerProducer && std::chrono::steady_clock::now() < deadline) {
+        if (!ring.TryPop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        uint32_t producer = value / itemsPerProducer;
+        inOrder = inOrder && value % itemsPerProducer == nextIndex[producer];
+        nextIndex[producer]++;
+        consumed++;
+    }
+    for (auto& thread : producers) {
+        thread.join();
+    }
+    EXPECT_EQ(consumed, producerCount * itemsPerProducer);
+    EXPECT_TRUE(inOrder);
+    EXPECT_TRUE(ring.Empty());
+    EXPECT_EQ(ring.Size(), 0);
+}
+} // namespace SelectionFwk
+} // namespace OHOS
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "selection_inject_timing.h"
+
+namespace OHOS {
+namespace SelectionFwk {
+using namespace testing::ext;
+
+namespace {
+const std::string FAST_BUNDLE = "com.example.fast";
+const std::string SLOW_BUNDLE = "com.example.slow";
+constexpr int64_t FAST_LATENCY_US = 4000;
+constexpr int64_t SLOW_LATENCY_US = 250000;
+} // namespace
+
+class SelectionInjectTimingTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void SelectionInjectTimingTest::SetUpTestCase()
+{
+    std::cout << "SelectionInjectTimingTest SetUpTestCase" << std::endl;
+}
+
+void SelectionInjectTimingTest::TearDownTestCase()
+{
+    std::cout << "SelectionInjectTimingTest TearDownTestCase" << std::endl;
+}
+
+void SelectionInjectTimingTest::SetUp()
+{
+    std::cout << "SelectionInjectTimingTest SetUp" << std::endl;
+}
+
+void SelectionInjectTimingTest::TearDown()
+{
+    std::cout << "SelectionInjectTimingTest TearDown" << std::endl;
+}
+
+/**
+ * @tc.name: SelectionInjectTiming001
+ * @tc.desc: test default timing is used until enough samples are learned
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionInjectTimingTest, SelectionInjectTiming001, TestSize.Level0)
+{
+    SelectionInjectTimingController controller;
+    SelectionInjectTiming timing = controller.GetTiming(FAST_BUNDLE);
+    EXPECT_EQ(timing.holdUs, DEFAULT_INJECT_HOLD_US);
+    EXPECT_EQ(timing.waitUs, DEFAULT_PASTEBOARD_WAIT_US);
+
+    for (size_t i = 0; i + 1 < INJECT_TIMING_MIN_SAMPLES; ++i) {
+        controller.RecordResponse(FAST_BUNDLE, FAST_LATENCY_US);
+    }
+    timing = controller.GetTiming(FAST_BUNDLE);
+    EXPECT_EQ(timing.holdUs, DEFAULT_INJECT_HOLD_US);
+    EXPECT_EQ(timing.waitUs, DEFAULT_PASTEBOARD_WAIT_US);
+}
+
+/**
+ * @tc.name: SelectionInjectTiming002
+ * @tc.desc: test fast and slow applications learn budgets within the hard bounds
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionInjectTimingTest, SelectionInjectTiming002, TestSize.Level0)
+{
+    SelectionInjectTimingController controller;
+    for (size_t i = 0; i < INJECT_TIMING_MIN_SAMPLES; ++i) {
+        controller.RecordResponse(FAST_BUNDLE, FAST_LATENCY_US);
+        controller.RecordResponse(SLOW_BUNDLE, SLOW_LATENCY_US);
+    }
+    SelectionInjectTiming fast = controller.GetTiming(FAST_BUNDLE);
+    EXPECT_EQ(fast.holdUs, FAST_LATENCY_US + INJECT_HOLD_MARGIN_US);
+    EXPECT_EQ(fast.waitUs, MIN_PASTEBOARD_WAIT_US);
+
+    SelectionInjectTiming slow = controller.GetTiming(SLOW_BUNDLE);
+    EXPECT_EQ(slow.holdUs, MAX_INJECT_HOLD_US);
+    EXPECT_EQ(slow.waitUs, MAX_PASTEBOARD_WAIT_US);
+    EXPECT_EQ(controller.GetStats().size(), 2);
+}
+
+/**
+ * @tc.name: SelectionInjectTiming003
+ * @tc.desc: test timeouts grow the wait budget until the next response
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionInjectTimingTest, SelectionInjectTiming003, TestSize.Level0)
+{
+    SelectionInjectTimingController controller;
+    controller.RecordTimeout(FAST_BUNDLE);
+    EXPECT_EQ(controller.GetTiming(FAST_BUNDLE).waitUs, DEFAULT_PASTEBOARD_WAIT_US * 2);
+
+    for (size_t i = 0; i < INJECT_TIMING_MIN_SAMPLES; ++i) {
+        controller.RecordResponse(FAST_BUNDLE, FAST_LATENCY_US);
+    }
+    EXPECT_EQ(controller.GetTiming(FAST_BUNDLE).waitUs, MIN_PASTEBOARD_WAIT_US);
+    controller.RecordTimeout(FAST_BUNDLE);
+    // The doubled budget is raised to cover the maximum hold used after a timeout
+    EXPECT_EQ(controller.GetTiming(FAST_BUNDLE).holdUs, MAX_INJECT_HOLD_US);
+    EXPECT_EQ(controller.GetTiming(FAST_BUNDLE).waitUs, MAX_INJECT_HOLD_US + PASTEBOARD_WAIT_MARGIN_US);
+    EXPECT_EQ(controller.GetStats().front().timeouts, 2);
+}
+
+/**
+ * @tc.name: SelectionInjectTiming004
+ * @tc.desc: test the wait budget always covers the hold plus margin
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionInjectTimingTest, SelectionInjectTiming004, TestSize.Level0)
+{
+    const std::vector<uint32_t> latencies = { 0, FAST_LATENCY_US, 20000, 40000, 55000, SLOW_LATENCY_US,
+        MAX_PASTEBOARD_WAIT_US };
+    for (size_t samples : { size_t(0), INJECT_TIMING_MIN_SAMPLES }) {
+        for (uint32_t p90Us : latencies) {
+            for (uint32_t streak = 0; streak <= INJECT_TIMING_MAX_TIMEOUT_SHIFT; ++streak) {
+                SelectionInjectTiming timing = SelectionInjectTimingController::ComputeTiming(samples, p90Us,
+                    p90Us, streak);
+                EXPECT_GE(timing.waitUs, timing.holdUs + PASTEBOARD_WAIT_MARGIN_US);
+                EXPECT_LE(timing.waitUs, MAX_PASTEBOARD_WAIT_US);
+            }
+        }
+    }
+}
+} // namespace SelectionFwk
+} // namespace OHOS
@@ -16,6 +16,7 @@
 #include "selection_input_monitor_common_test.h"
 #include "selection_input_monitor.h"
 #include "selection_errors.h"
+#include "focus_monitor_manager.h"
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -120,5 +121,122 @@ HWTEST_F(SelectionInputMonitorTest, SelectInputMonitor003, TestSize.Level0)
     ASSERT_EQ(MemSelectionConfig::GetInstance().GetEnable(), true);
 }
 
+/**
+ * @tc.name: SelectInputMonitor004
+ * @tc.desc: test hover move is dropped before state machine when state is idle
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionInputMonitorTest, SelectInputMonitor004, TestSize.Level0)
+{
+    std::cout << "SelectInputMonitor004 start" << std::endl;
+    NONE_BUTTON_MOVE(inputMonitor);
+    NONE_BUTTON_MOVE(inputMonitor);
+    NONE_BUTTON_MOVE(inputMonitor);
+    EXPECT_EQ(inputMonitor->GetDroppedMoveEventCount(), 3);
+    EXPECT_EQ(inputMonitor->GetProcessedPointerEventCount(), 0);
+
+    LEFT_BUTTON_DOWN(inputMonitor);
+    EXPECT_FALSE(inputMonitor->baseInputMonitor_->IsHoverInert());
+    NONE_BUTTON_MOVE(inputMonitor);
+    EXPECT_EQ(inputMonitor->GetProcessedPointerEventCount(), 2);
+    EXPECT_EQ(inputMonitor->baseInputMonitor_->GetSelectState(), SelectInputState::SELECT_INPUT_INITIAL);
+
+    NONE_BUTTON_MOVE(inputMonitor);
+    EXPECT_EQ(inputMonitor->GetDroppedMoveEventCount(), 4);
+    EXPECT_EQ(inputMonitor->GetProcessedPointerEventCount(), 2);
+}
+
+/**
+ * @tc.name: SelectInputMonitor005
+ * @tc.desc: test window bundle name cache is bounded and invalidated by focus change
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionInputMonitorTest, SelectInputMonitor005, TestSize.Level0)
+{
+    std::cout << "SelectInputMonitor005 start" << std::endl;
+    auto cache = inputMonitor->baseInputMonitor_->bundleNameCache_;
+    std::string bundleName;
+    cache->Put(1, "com.example.first");
+    ASSERT_TRUE(cache->Get(1, bundleName));
+    EXPECT_EQ(bundleName, "com.example.first");
+
+    inputMonitor->HandleFocusChanged(1);
+    EXPECT_FALSE(cache->Get(1, bundleName));
+
+    for (int32_t windowId = 0; windowId <= static_cast<int32_t>(MAX_BUNDLE_NAME_CACHE_SIZE); ++windowId) {
+        cache->Put(windowId, "com.example.app");
+    }
+    EXPECT_LE(cache->bundleNames_.size(), MAX_BUNDLE_NAME_CACHE_SIZE);
+    EXPECT_TRUE(cache->Get(MAX_BUNDLE_NAME_CACHE_SIZE, bundleName));
+}
+
+/**
+ * @tc.name: SelectInputMonitor006
+ * @tc.desc: test window bundle name is resolved on the persistent query thread and waited for by the caller
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionInputMonitorTest, SelectInputMonitor006, TestSize.Level0)
+{
+    std::cout << "SelectInputMonitor006 start" << std::endl;
+    auto cache = std::make_shared<WindowBundleNameCache>();
+    WindowBundleNameResolver resolver(cache, [](int32_t windowId) {
+        return windowId == 1 ? std::string("com.example.first") : std::string();
+    });
+    std::string bundleName;
+    EXPECT_FALSE(resolver.Wait(1, bundleName, 0));
+
+    resolver.Request(1);
+    resolver.Request(2);
+    ASSERT_TRUE(resolver.Wait(1, bundleName, WINDOW_INFO_WAIT_TIMEOUT_MS));
+    EXPECT_EQ(bundleName, "com.example.first");
+    EXPECT_FALSE(resolver.Wait(2, bundleName, WINDOW_INFO_WAIT_TIMEOUT_MS));
+    EXPECT_TRUE(cache->Get(1, bundleName));
+    EXPECT_FALSE(cache->Get(2, bundleName));
+}
+
+/**
+ * @tc.name: SelectInputMonitor007
+ * @tc.desc: test selection content requests use the last notified selection instead of the active pointer slot
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionInputMonitorTest, SelectInputMonitor007, TestSize.Level0)
+{
+    std::cout << "SelectInputMonitor007 start" << std::endl;
+    SelectionInfo notified;
+    notified.windowId = 5;
+    notified.bundleName = "com.example.notified";
+    inputMonitor->SetLastNotifiedSelection(3, notified);
+
+    LEFT_BUTTON_DOWN(inputMonitor);
+    SelectionInfo selectionInfo;
+    EXPECT_EQ(inputMonitor->GetLastNotifiedSelection(selectionInfo), 3);
+    EXPECT_EQ(selectionInfo.windowId, 5);
+    EXPECT_EQ(selectionInfo.bundleName, "com.example.notified");
+}
+
+/**
+ * @tc.name: SelectInputMonitor008
+ * @tc.desc: test focus changes from the window manager reset the last notified focus window (A -> B -> A)
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionInputMonitorTest, SelectInputMonitor008, TestSize.Level0)
+{
+    std::cout << "SelectInputMonitor008 start" << std::endl;
+    constexpr int32_t windowA = 100;
+    constexpr int32_t windowB = 200;
+    // A click on window A notified FocusChange for A
+    inputMonitor->lastNotifiedFocusWindowId_.store(windowA);
+
+    // Window manager moves focus to B, then back to A
+    inputMonitor->HandleFocusChanged(windowB);
+    EXPECT_EQ(inputMonitor->lastNotifiedFocusWindowId_.load(), INVALID_FOCUS_WINDOW_ID);
+    inputMonitor->lastNotifiedFocusWindowId_.store(windowB);
+    inputMonitor->HandleFocusChanged(windowA);
+    EXPECT_EQ(inputMonitor->lastNotifiedFocusWindowId_.load(), INVALID_FOCUS_WINDOW_ID);
+
+    // The next click on A is no longer treated as a repeat of the first notification
+    EXPECT_NE(inputMonitor->lastNotifiedFocusWindowId_.exchange(windowA), windowA);
+}
+
 } // namespace SelectionFwk
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <vector>
+
+#include "selection_input_monitor_common_test.h"
+#include "selection_input_transition.h"
+
+namespace OHOS {
+namespace SelectionFwk {
+namespace {
+constexpr uint32_t HOVER_FLOOD_EVENTS = 100000;
+
+using Event = SelectInputEvent;
+using State = SelectInputState;
+using SubState = SelectInputSubState;
+
+std::shared_ptr<PointerEvent> GetTimedLeftEvent(int32_t action, int64_t timeMs)
+{
+    std::shared_ptr<PointerEvent> pointerEvent = GetPointerEvent();
+    pointerEvent->SetButtonId(PointerEvent::MOUSE_BUTTON_LEFT);
+    pointerEvent->SetPointerAction(action);
+    pointerEvent->SetActionTime(timeMs * USEC_PER_MSEC);
+    return pointerEvent;
+}
+
+std::shared_ptr<PointerEvent> GetDeviceLeftEvent(int32_t action, int64_t timeMs, int32_t deviceId, int32_t displayId)
+{
+    std::shared_ptr<PointerEvent> pointerEvent = GetTimedLeftEvent(action, timeMs);
+    pointerEvent->SetDeviceId(deviceId);
+    pointerEvent->SetTargetDisplayId(displayId);
+    pointerEvent->SetTargetWindowId(displayId);
+    return pointerEvent;
+}
+
+std::shared_ptr<PointerEvent> GetTouchEvent(int32_t action, int64_t timeMs, int32_t offsetX = 0)
+{
+    std::shared_ptr<PointerEvent> pointerEvent = PointerEvent::Create();
+    PointerEvent::PointerItem pointerItem;
+    pointerItem.SetPointerId(0);
+    pointerItem.SetGlobalX(GLOBAL_X_OFFSET + offsetX);
+    pointerItem.SetGlobalY(GLOBAL_Y_OFFSET);
+    pointerEvent->SetPointerId(0);
+    pointerEvent->AddPointerItem(pointerItem);
+    pointerEvent->SetSourceType(PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
+    pointerEvent->SetPointerAction(action);
+    pointerEvent->SetTargetDisplayId(0);
+    pointerEvent->SetTargetWindowId(0);
+    pointerEvent->SetActionTime(timeMs * USEC_PER_MSEC);
+    return pointerEvent;
+}
+
+void ReplayLeftClick(const std::shared_ptr<BaseSelectionInputMonitor>& inputMonitor, int64_t timeMs)
+{
+    inputMonitor->OnInputEvent(GetTimedLeftEvent(PointerEvent::POINTER_ACTION_BUTTON_DOWN, timeMs));
+    inputMonitor->OnInputEvent(GetTimedLeftEvent(PointerEvent::POINTER_ACTION_BUTTON_UP, timeMs));
+}
+} // namespace
+
+class SelectionInputTransitionTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void SelectionInputTransitionTest::SetUpTestCase()
+{
+    std::cout << "SelectionInputTransitionTest SetUpTestCase" << std::endl;
+}
+
+void SelectionInputTransitionTest::TearDownTestCase()
+{
+    std::cout << "SelectionInputTransitionTest TearDownTestCase" << std::endl;
+}
+
+void SelectionInputTransitionTest::SetUp()
+{
+    std::cout << "SelectionInputTransitionTest SetUp" << std::endl;
+}
+
+void SelectionInputTransitionTest::TearDown()
+{
+    std::cout << "SelectionInputTransitionTest TearDown" << std::endl;
+}
+
+/**
+ * @tc.name: SelectionInputTransition001
+ * @tc.desc: compiled table matches the transition rules for every entry
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionInputTransitionTest, SelectionInputTransition001, TestSize.Level0)
+{
+    for (uint32_t trigger = 0; trigger < SelectInputTransitionTable::TRIGGER_COUNT; ++trigger) {
+        for (uint32_t state = 0; state < SelectInputTransitionTable::STATE_COUNT; ++state) {
+            for (uint32_t sub = 0; sub < SelectInputTransitionTable::SUB_STATE_COUNT; ++sub) {
+                for (uint32_t event = 0; event < SelectInputTransitionTable::EVENT_COUNT; ++event) {
+                    auto s = static_cast<State>(state);
+                    auto ss = static_cast<SubState>(sub);
+                    auto e = static_cast<Event>(event);
+                    auto expected = SelectInputRules::Evaluate(s, ss, e, trigger != 0);
+                    auto& actual = SelectInputTransitionTable::Lookup(trigger != 0, s, ss, e);
+                    ASSERT_EQ(actual.nextState, expected.nextState);
+                    ASSERT_EQ(actual.nextSubState, expected.nextSubState);
+                    ASSERT_EQ(actual.action, expected.action);
+                    ASSERT_EQ(actual.checkFinished, expected.checkFinished);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @tc.name: SelectionInputTransition002
+ * @tc.desc: click timing classes drive double and triple click transitions
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionInputTransitionTest, SelectionInputTransition002, TestSize.Level0)
+{
+    auto transition = SelectInputTransitionTable::Lookup(false, State::SELECT_INPUT_WAIT_DOUBLE_CLICK,
+        SubState::SUB_WAIT_POINTER_ACTION_BUTTON_DOWN, Event::POINTER_LEFT_DOWN_IN_DOUBLE);
+    EXPECT_EQ(transition.nextState, State::SELECT_INPUT_WAIT_DOUBLE_CLICK);
+    EXPECT_EQ(transition.nextSubState, SubState::SUB_WAIT_POINTER_ACTION_BUTTON_UP);
+    EXPECT_EQ(transition.action, SelectInputAction::ACTION_STAMP_CLICK);
+
+    transition = SelectInputTransitionTable::Lookup(false, State::SELECT_INPUT_WAIT_DOUBLE_CLICK,
+        SubState::SUB_WAIT_POINTER_ACTION_BUTTON_DOWN, Event::POINTER_LEFT_DOWN_LATE);
+    EXPECT_EQ(transition.nextState, State::SELECT_INPUT_WORD_BEGIN);
+    EXPECT_EQ(transition.action, SelectInputAction::ACTION_BEGIN);
+
+    transition = SelectInputTransitionTable::Lookup(false, State::SELECT_INPUT_DONE,
+        SubState::SUB_WAIT_POINTER_ACTION_BUTTON_DOWN, Event::POINTER_LEFT_DOWN_IN_DOUBLE);
+    EXPECT_EQ(transition.nextState, State::SELECT_INPUT_WORD_BEGIN);
+
+    transition = SelectInputTransitionTable::Lookup(true, State::SELECT_INPUT_WAIT_TRIPLE_CLICK,
+        SubState::SUB_WAIT_POINTER_ACTION_BUTTON_UP, Event::POINTER_LEFT_UP);
+    EXPECT_EQ(transition.nextState, State::SELECT_INPUT_WORD_END);
+    EXPECT_EQ(transition.nextSubState, SubState::SUB_WAIT_KEY_CTRL_DOWN);
+    EXPECT_EQ(transition.action, SelectInputAction::ACTION_SAVE_END);
+}
+
+/**
+ * @tc.name: SelectionInputTransition004
+ * @tc.desc: hover flood through BaseSelectionInputMonitor stays in initial state
+ * @tc.type: PERF
+ */
+HWTEST_F(SelectionInputTransitionTest, SelectionInputTransition004, TestSize.Level1)
+{
+    auto inputMonitor = std::make_shared<BaseSelectionInputMonitor>();
+    std::shared_ptr<PointerEvent> pointerEvent = GetPointerEvent();
+    pointerEvent->SetButtonId(PointerEvent::BUTTON_NONE);
+    pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_MOVE);
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < HOVER_FLOOD_EVENTS; ++i) {
+        inputMonitor->OnInputEvent(pointerEvent);
+    }
+    auto end = std::chrono::steady_clock::now();
+    auto costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    std::cout << "hover flood: " << static_cast<double>(costNs) / HOVER_FLOOD_EVENTS << " ns/event" << std::endl;
+    EXPECT_EQ(inputMonitor->GetSelectState(), State::SELECT_INPUT_INITIAL);
+    EXPECT_FALSE(inputMonitor->IsSelectionTriggered());
+}
+
+/**
+ * @tc.name: SelectionInputTransition005
+ * @tc.desc: replay mode detects double click purely from event timestamps
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionInputTransitionTest, SelectionInputTransition005, TestSize.Level0)
+{
+    MemSelectionConfig::GetInstance().SetTriggered(false);
+    auto inputMonitor = std::make_shared<BaseSelectionInputMonitor>();
+    inputMonitor->SetReplayMode(true);
+
+    ReplayLeftClick(inputMonitor, 0);
+    ReplayLeftClick(inputMonitor, DOUBLE_CLICK_INTERVAL);
+    EXPECT_TRUE(inputMonitor->IsSelectionTriggered());
+    EXPECT_EQ(inputMonitor->GetSelectionInfo().selectionType, DOUBLE_CLICKED_SELECTION);
+
+    int64_t lateTime = DOUBLE_CLICK_INTERVAL + TEST_CLICK_WAIT_INTERVAL;
+    ReplayLeftClick(inputMonitor, lateTime);
+    ReplayLeftClick(inputMonitor, lateTime + TEST_CLICK_WAIT_INTERVAL);
+    EXPECT_FALSE(inputMonitor->IsSelectionTriggered());
+}
+
+/**
+ * @tc.name: SelectionInputTransition006
+ * @tc.desc: click timing is not affected by the time events are delivered
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionInputTransitionTest, SelectionInputTransition006, TestSize.Level0)
+{
+    MemSelectionConfig::GetInstance().SetTriggered(false);
+    auto inputMonitor = std::make_shared<BaseSelectionInputMonitor>();
+    inputMonitor->SetReplayMode(true);
+
+    // 事件时间戳相差超过双击间隔，即使连续投递也不能识别为双击
+    ReplayLeftClick(inputMonitor, TEST_CLICK_WAIT_INTERVAL);
+    ReplayLeftClick(inputMonitor, TEST_CLICK_WAIT_INTERVAL * 2);
+    EXPECT_FALSE(inputMonitor->IsSelectionTriggered());
+
+    ReplayLeftClick(inputMonitor, TEST_CLICK_WAIT_INTERVAL * 2 + TRIPLE_CLICK_TIME);
+    EXPECT_TRUE(inputMonitor->IsSelectionTriggered());
+}
+
+/**
+ * @tc.name: SelectionInputTransition007
+ * @tc.desc: interleaved events from two pointer devices are tracked in separate slots
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionInputTransitionTest, SelectionInputTransition007, TestSize.Level0)
+{
+    MemSelectionConfig::GetInstance().SetTriggered(false);
+    auto inputMonitor = std::make_shared<BaseSelectionInputMonitor>();
+    inputMonitor->SetReplayMode(true);
+    constexpr int32_t mouseDevice = 1;
+    constexpr int32_t touchpadDevice = 2;
+    constexpr int32_t mainDisplay = 0;
+    constexpr int32_t extendDisplay = 1;
+
+    // 鼠标在主屏拖选的过程中，触控板在扩展屏上点击
+    inputMonitor->OnInputEvent(
+        GetDeviceLeftEvent(PointerEvent::POINTER_ACTION_BUTTON_DOWN, 0, mouseDevice, mainDisplay));
+    inputMonitor->OnInputEvent(GetDeviceLeftEvent(PointerEvent::POINTER_ACTION_MOVE, 10, mouseDevice, mainDisplay));
+    inputMonitor->OnInputEvent(
+        GetDeviceLeftEvent(PointerEvent::POINTER_ACTION_BUTTON_DOWN, 20, touchpadDevice, extendDisplay));
+    inputMonitor->OnInputEvent(
+        GetDeviceLeftEvent(PointerEvent::POINTER_ACTION_BUTTON_UP, 20, touchpadDevice, extendDisplay));
+    EXPECT_FALSE(inputMonitor->IsHoverInert(touchpadDevice, extendDisplay));
+    EXPECT_FALSE(inputMonitor->IsSelectionTriggered());
+
+    inputMonitor->OnInputEvent(GetDeviceLeftEvent(PointerEvent::POINTER_ACTION_MOVE, 30, mouseDevice, mainDisplay));
+    inputMonitor->OnInputEvent(
+        GetDeviceLeftEvent(PointerEvent::POINTER_ACTION_BUTTON_UP, 40, mouseDevice, mainDisplay));
+    EXPECT_TRUE(inputMonitor->IsSelectionTriggered());
+    EXPECT_EQ(inputMonitor->GetSelectionInfo().selectionType, MOVE_SELECTION);
+    EXPECT_EQ(inputMonitor->GetSelectionInfo().displayId, static_cast<uint32_t>(mainDisplay));
+
+    // 触控板的第二次点击仍在双击间隔内
+    inputMonitor->OnInputEvent(
+        GetDeviceLeftEvent(PointerEvent::POINTER_ACTION_BUTTON_DOWN, 100, touchpadDevice, extendDisplay));
+    inputMonitor->OnInputEvent(
+        GetDeviceLeftEvent(PointerEvent::POINTER_ACTION_BUTTON_UP, 100, touchpadDevice, extendDisplay));
+    EXPECT_TRUE(inputMonitor->IsSelectionTriggered());
+    EXPECT_EQ(inputMonitor->GetSelectionInfo().selectionType, DOUBLE_CLICKED_SELECTION);
+    EXPECT_EQ(inputMonitor->GetSelectionInfo().displayId, static_cast<uint32_t>(extendDisplay));
+}
+
+/**
+ * @tc.name: SelectionInputTransition008
+ * @tc.desc: least recently used slot is reused when all slots are taken
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionInputTransitionTest, SelectionInputTransition008, TestSize.Level0)
+{
+    auto inputMonitor = std::make_shared<BaseSelectionInputMonitor>();
+    inputMonitor->SetReplayMode(true);
+    for (int32_t deviceId = 0; deviceId <= static_cast<int32_t>(MAX_SELECTION_POINTER_SLOTS); ++deviceId) {
+        inputMonitor->OnInputEvent(
+            GetDeviceLeftEvent(PointerEvent::POINTER_ACTION_BUTTON_DOWN, deviceId, deviceId, 0));
+    }
+    // 第一个设备最久未使用，已被最后一个设备挤出
+    EXPECT_EQ(inputMonitor->FindSlot(0, 0), MAX_SELECTION_POINTER_SLOTS);
+    EXPECT_LT(inputMonitor->FindSlot(static_cast<int32_t>(MAX_SELECTION_POINTER_SLOTS), 0),
+        MAX_SELECTION_POINTER_SLOTS);
+    EXPECT_TRUE(inputMonitor->IsHoverInert(0, 0));
+    EXPECT_EQ(inputMonitor->GetSelectState(), State::SELECT_INPUT_WORD_BEGIN);
+}
+
+/**
+ * @tc.name: SelectionInputTransition009
+ * @tc.desc: touch long press then drag produces a move selection, long press alone selects a word
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionInputTransitionTest, SelectionInputTransition009, TestSize.Level0)
+{
+    MemSelectionConfig::GetInstance().SetTriggered(false);
+    auto inputMonitor = std::make_shared<BaseSelectionInputMonitor>();
+    inputMonitor->SetReplayMode(true);
+    constexpr int32_t dragOffset = TOUCH_SLOP * 10;
+
+    inputMonitor->OnInputEvent(GetTouchEvent(PointerEvent::POINTER_ACTION_DOWN, 0));
+    inputMonitor->OnInputEvent(GetTouchEvent(PointerEvent::POINTER_ACTION_MOVE, TOUCH_LONG_PRESS_TIME, 1));
+    EXPECT_EQ(inputMonitor->GetSelectState(), State::SELECT_INPUT_WAIT_DOUBLE_CLICK);
+    inputMonitor->OnInputEvent(
+        GetTouchEvent(PointerEvent::POINTER_ACTION_MOVE, TOUCH_LONG_PRESS_TIME + 10, dragOffset));
+    inputMonitor->OnInputEvent(
+        GetTouchEvent(PointerEvent::POINTER_ACTION_UP, TOUCH_LONG_PRESS_TIME + 20, dragOffset));
+    EXPECT_TRUE(inputMonitor->IsSelectionTriggered());
+    EXPECT_EQ(inputMonitor->GetSelectionInfo().selectionType, MOVE_SELECTION);
+    EXPECT_EQ(inputMonitor->GetSelectionInfo().endDisplayX, GLOBAL_X_OFFSET + dragOffset);
+
+    // 按住不动直到抬起，抬起时补发长按
+    int64_t start = TEST_CLICK_WAIT_INTERVAL * 10;
+    inputMonitor->OnInputEvent(GetTouchEvent(PointerEvent::POINTER_ACTION_DOWN, start));
+    EXPECT_FALSE(inputMonitor->IsSelectionTriggered());
+    inputMonitor->OnInputEvent(GetTouchEvent(PointerEvent::POINTER_ACTION_UP, start + TOUCH_LONG_PRESS_TIME));
+    EXPECT_TRUE(inputMonitor->IsSelectionTriggered());
+    EXPECT_EQ(inputMonitor->GetSelectionInfo().selectionType, DOUBLE_CLICKED_SELECTION);
+}
+
+/**
+ * @tc.name: SelectionInputTransition010
+ * @tc.desc: touch tap and scroll before long press do not produce selection
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionInputTransitionTest, SelectionInputTransition010, TestSize.Level0)
+{
+    MemSelectionConfig::GetInstance().SetTriggered(false);
+    auto inputMonitor = std::make_shared<BaseSelectionInputMonitor>();
+    inputMonitor->SetReplayMode(true);
+
+    inputMonitor->OnInputEvent(GetTouchEvent(PointerEvent::POINTER_ACTION_DOWN, 0));
+    inputMonitor->OnInputEvent(GetTouchEvent(PointerEvent::POINTER_ACTION_UP, TOUCH_LONG_PRESS_TIME / 2));
+    EXPECT_FALSE(inputMonitor->IsSelectionTriggered());
+    EXPECT_EQ(inputMonitor->ActiveSlot().touchState, SelectTouchState::TOUCH_IDLE);
+
+    int64_t start = TOUCH_LONG_PRESS_TIME;
+    inputMonitor->OnInputEvent(GetTouchEvent(PointerEvent::POINTER_ACTION_DOWN, start));
+    inputMonitor->OnInputEvent(GetTouchEvent(PointerEvent::POINTER_ACTION_MOVE, start + 10, TOUCH_SLOP * 2));
+    EXPECT_EQ(inputMonitor->ActiveSlot().touchState, SelectTouchState::TOUCH_IDLE);
+    inputMonitor->OnInputEvent(
+        GetTouchEvent(PointerEvent::POINTER_ACTION_UP, start + TOUCH_LONG_PRESS_TIME * 2, TOUCH_SLOP * 2));
+    EXPECT_FALSE(inputMonitor->IsSelectionTriggered());
+
+    EXPECT_EQ(SelectTouchTransitionTable::Lookup(true, SelectTouchState::TOUCH_LONG_PRESSED,
+        SelectTouchEvent::TOUCH_UP).publicState, State::SELECT_INPUT_WORD_END);
+}
+} // namespace SelectionFwk
+} // namespace OHOS
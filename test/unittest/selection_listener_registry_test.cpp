@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+
+#include "gtest/gtest.h"
+#include "selection_errors.h"
+#include "selection_listener_registry.h"
+#include "selection_listener_stub.h"
+
+namespace OHOS {
+namespace SelectionFwk {
+using namespace testing::ext;
+
+namespace {
+class FakeSelectionListener : public SelectionListenerStub {
+public:
+    ErrCode OnSelectionChange(const SelectionInfoData& selectionInfoData) override
+    {
+        return NO_ERROR;
+    }
+
+    ErrCode FocusChange(const SelectionFocusChangeInfo& focusChangeInfo) override
+    {
+        return NO_ERROR;
+    }
+
+    ErrCode OnSelectionEvents(const SelectionEventBatch& eventBatch) override
+    {
+        for (const auto& event : eventBatch.events) {
+            if (event.type == SelectionEventType::SELECTION) {
+                selectionCount++;
+            } else if (event.type == SelectionEventType::FOCUS_CHANGE) {
+                focusCount++;
+            }
+        }
+        return NO_ERROR;
+    }
+
+    std::atomic<uint32_t> selectionCount = 0;
+    std::atomic<uint32_t> focusCount = 0;
+};
+} // namespace
+
+class SelectionListenerRegistryTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void SelectionListenerRegistryTest::SetUpTestCase()
+{
+    std::cout << "SelectionListenerRegistryTest SetUpTestCase" << std::endl;
+}
+
+void SelectionListenerRegistryTest::TearDownTestCase()
+{
+    std::cout << "SelectionListenerRegistryTest TearDownTestCase" << std::endl;
+}
+
+void SelectionListenerRegistryTest::SetUp()
+{
+    std::cout << "SelectionListenerRegistryTest SetUp" << std::endl;
+}
+
+void SelectionListenerRegistryTest::TearDown()
+{
+    std::cout << "SelectionListenerRegistryTest TearDown" << std::endl;
+}
+
+/**
+ * @tc.name: SelectionListenerRegistry001
+ * @tc.desc: test events fan out to listeners according to their event masks
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionListenerRegistryTest, SelectionListenerRegistry001, TestSize.Level0)
+{
+    SelectionListenerRegistry registry;
+    sptr<FakeSelectionListener> panel = new FakeSelectionListener();
+    sptr<FakeSelectionListener> observer = new FakeSelectionListener();
+    EXPECT_EQ(registry.Add(panel, SELECTION_EVENT_MASK_ALL, 1), NO_ERROR);
+    EXPECT_EQ(registry.Add(observer, SelectionEventMask(SelectionEventType::SELECTION), 2), NO_ERROR);
+    EXPECT_EQ(registry.Size(), 2);
+    EXPECT_EQ(registry.GetPrimaryListener(), panel);
+
+    SelectionFocusChangeInfo focusInfo(1, 0, 1, 1, 1, true, FocusChangeSource::WindowManager);
+    registry.Post(SelectionNotifyEvent::FromFocusChange(focusInfo));
+    SelectionInfo info;
+    EXPECT_EQ(registry.PostAndFlush(SelectionNotifyEvent::FromSelection(info)), NO_ERROR);
+
+    EXPECT_EQ(panel->selectionCount.load(), 1);
+    EXPECT_EQ(panel->focusCount.load(), 1);
+    EXPECT_EQ(observer->selectionCount.load(), 1);
+    EXPECT_EQ(observer->focusCount.load(), 0);
+}
+
+/**
+ * @tc.name: SelectionListenerRegistry002
+ * @tc.desc: test removal keeps existing snapshots valid and re-registration updates the mask
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionListenerRegistryTest, SelectionListenerRegistry002, TestSize.Level0)
+{
+    SelectionListenerRegistry registry;
+    sptr<FakeSelectionListener> listener = new FakeSelectionListener();
+    EXPECT_EQ(registry.Add(listener, SelectionEventMask(SelectionEventType::FOCUS_CHANGE), 1), NO_ERROR);
+    EXPECT_FALSE(registry.HasListener(SelectionEventMask(SelectionEventType::SELECTION)));
+    EXPECT_EQ(registry.Add(listener, SELECTION_EVENT_MASK_ALL, 1), NO_ERROR);
+    EXPECT_EQ(registry.Size(), 1);
+    EXPECT_TRUE(registry.HasListener(SelectionEventMask(SelectionEventType::SELECTION)));
+
+    auto snapshot = registry.GetSnapshot();
+    EXPECT_TRUE(registry.Remove(listener->AsObject()));
+    EXPECT_FALSE(registry.Remove(listener->AsObject()));
+    EXPECT_EQ(snapshot->size(), 1);
+    EXPECT_EQ(registry.Size(), 0);
+    SelectionInfo info;
+    EXPECT_EQ(registry.PostAndFlush(SelectionNotifyEvent::FromSelection(info)), SelectionServiceError::INVALID_DATA);
+}
+
+/**
+ * @tc.name: SelectionListenerRegistry003
+ * @tc.desc: test registry rejects listeners beyond the limit
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionListenerRegistryTest, SelectionListenerRegistry003, TestSize.Level0)
+{
+    SelectionListenerRegistry registry;
+    std::vector<sptr<FakeSelectionListener>> listeners;
+    for (size_t i = 0; i < MAX_SELECTION_LISTENERS; ++i) {
+        listeners.push_back(new FakeSelectionListener());
+        EXPECT_EQ(registry.Add(listeners.back(), SELECTION_EVENT_MASK_ALL, 1), NO_ERROR);
+    }
+    sptr<FakeSelectionListener> extra = new FakeSelectionListener();
+    EXPECT_EQ(registry.Add(extra, SELECTION_EVENT_MASK_ALL, 1), SelectionServiceError::LISTENER_LIMIT_EXCEEDED);
+    EXPECT_EQ(registry.Add(nullptr, SELECTION_EVENT_MASK_ALL, 1), SelectionServiceError::INVALID_DATA);
+    registry.Clear();
+    EXPECT_EQ(registry.Size(), 0);
+}
+} // namespace SelectionFwk
+} // namespace OHOS
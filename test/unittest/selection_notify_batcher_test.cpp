@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "message_parcel.h"
+#include "selection_notify_batcher.h"
+
+namespace OHOS {
+namespace SelectionFwk {
+using namespace testing::ext;
+
+namespace {
+constexpr int32_t WAIT_FLUSH_TIMEOUT_MS = 1000;
+
+SelectionFocusChangeInfo MakeFocusInfo(int32_t windowId)
+{
+    return SelectionFocusChangeInfo(windowId, 0, 1, 1, 1, true, FocusChangeSource::WindowManager);
+}
+} // namespace
+
+class SelectionNotifyBatcherTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void SelectionNotifyBatcherTest::SetUpTestCase()
+{
+    std::cout << "SelectionNotifyBatcherTest SetUpTestCase" << std::endl;
+}
+
+void SelectionNotifyBatcherTest::TearDownTestCase()
+{
+    std::cout << "SelectionNotifyBatcherTest TearDownTestCase" << std::endl;
+}
+
+void SelectionNotifyBatcherTest::SetUp()
+{
+    std::cout << "SelectionNotifyBatcherTest SetUp" << std::endl;
+}
+
+void SelectionNotifyBatcherTest::TearDown()
+{
+    std::cout << "SelectionNotifyBatcherTest TearDown" << std::endl;
+}
+
+/**
+ * @tc.name: SelectionNotifyBatcher001
+ * @tc.desc: test focus event is coalesced into the batch of a selection that is already pending
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionNotifyBatcherTest, SelectionNotifyBatcher001, TestSize.Level0)
+{
+    std::vector<SelectionEventBatch> batches;
+    std::promise<void> firstSent;
+    std::shared_future<void> firstSentFuture = firstSent.get_future().share();
+    auto batcher = std::make_shared<SelectionNotifyBatcher>([&](const SelectionEventBatch& batch) {
+        if (batches.empty()) {
+            // Hold the first transaction so that the second selection stays pending
+            firstSentFuture.wait();
+        }
+        batches.push_back(batch);
+        return NO_ERROR;
+    }, WAIT_FLUSH_TIMEOUT_MS);
+
+    SelectionInfo info;
+    info.windowId = 10;
+    info.selectionType = DOUBLE_CLICKED_SELECTION;
+    auto waitUntil = [](const std::function<bool()>& condition) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(WAIT_FLUSH_TIMEOUT_MS);
+        while (!condition() && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+    };
+    std::thread first([&]() { batcher->PostAndFlush(SelectionNotifyEvent::FromSelection(info)); });
+    waitUntil([&batcher]() { return batcher->GetStats().transactions == 1; });
+    std::thread second([&]() { batcher->PostAndFlush(SelectionNotifyEvent::FromSelection(info)); });
+    waitUntil([&batcher]() { return batcher->GetStats().events == 2; });
+    batcher->Post(SelectionNotifyEvent::FromFocusChange(MakeFocusInfo(10)));
+    firstSent.set_value();
+    first.join();
+    second.join();
+
+    ASSERT_EQ(batches.size(), 2);
+    ASSERT_EQ(batches[1].events.size(), 2);
+    EXPECT_EQ(batches[1].events[0].type, SelectionEventType::SELECTION);
+    EXPECT_EQ(batches[1].events[0].selectionInfo.selectionType, DOUBLE_CLICKED_SELECTION);
+    EXPECT_EQ(batches[1].events[1].type, SelectionEventType::FOCUS_CHANGE);
+    EXPECT_EQ(batches[1].events[1].windowId, 10);
+
+    SelectionNotifyStats stats = batcher->GetStats();
+    EXPECT_EQ(stats.events, 3);
+    EXPECT_EQ(stats.transactions, 2);
+    EXPECT_EQ(stats.failures, 0);
+}
+
+/**
+ * @tc.name: SelectionNotifyBatcher002
+ * @tc.desc: test focus-only events are sent immediately without waiting for the coalescing window
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionNotifyBatcherTest, SelectionNotifyBatcher002, TestSize.Level0)
+{
+    size_t sentEvents = 0;
+    auto batcher = std::make_shared<SelectionNotifyBatcher>([&](const SelectionEventBatch& batch) {
+        sentEvents += batch.events.size();
+        return NO_ERROR;
+    }, WAIT_FLUSH_TIMEOUT_MS);
+
+    batcher->Post(SelectionNotifyEvent::FromFocusChange(MakeFocusInfo(1)));
+    EXPECT_EQ(sentEvents, 1);
+    batcher->Post(SelectionNotifyEvent::FromFocusChange(MakeFocusInfo(2)));
+    EXPECT_EQ(sentEvents, 2);
+    EXPECT_EQ(batcher->GetStats().transactions, 2);
+}
+
+/**
+ * @tc.name: SelectionNotifyBatcher003
+ * @tc.desc: test SelectionEventBatch marshalling round trip and size bound
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionNotifyBatcherTest, SelectionNotifyBatcher003, TestSize.Level0)
+{
+    SelectionEventBatch batch;
+    SelectionInfo info;
+    info.bundleName = "com.example.selection";
+    info.endDisplayX = 100;
+    batch.events.push_back(SelectionNotifyEvent::FromFocusChange(MakeFocusInfo(7)));
+    batch.events.push_back(SelectionNotifyEvent::FromSelection(info));
+
+    MessageParcel parcel;
+    ASSERT_TRUE(batch.Marshalling(parcel));
+    sptr<SelectionEventBatch> result = SelectionEventBatch::Unmarshalling(parcel);
+    ASSERT_NE(result, nullptr);
+    ASSERT_EQ(result->events.size(), 2);
+    EXPECT_EQ(result->events[0].windowId, 7);
+    EXPECT_EQ(result->events[1].selectionInfo.bundleName, info.bundleName);
+    EXPECT_EQ(result->events[1].selectionInfo.endDisplayX, 100);
+
+    MessageParcel oversized;
+    oversized.WriteUint32(MAX_SELECTION_EVENT_BATCH_SIZE + 1);
+    EXPECT_EQ(SelectionEventBatch::Unmarshalling(oversized), nullptr);
+}
+
+/**
+ * @tc.name: SelectionNotifyBatcher004
+ * @tc.desc: test bounded queue drops oldest events while a batch is being sent
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionNotifyBatcherTest, SelectionNotifyBatcher004, TestSize.Level0)
+{
+    constexpr size_t capacity = 4;
+    std::vector<SelectionEventBatch> batches;
+    std::promise<void> firstSent;
+    std::shared_future<void> firstSentFuture = firstSent.get_future().share();
+    auto batcher = std::make_shared<SelectionNotifyBatcher>([&](const SelectionEventBatch& batch) {
+        if (batches.empty()) {
+            firstSentFuture.wait();
+        }
+        batches.push_back(batch);
+        return NO_ERROR;
+    }, WAIT_FLUSH_TIMEOUT_MS, capacity);
+
+    std::thread sender([&batcher]() { batcher->PostAndFlush(SelectionNotifyEvent::FromSelection(SelectionInfo())); });
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(WAIT_FLUSH_TIMEOUT_MS);
+    while (batcher->GetStats().transactions < 1 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    // The selection batch is being sent, so focus events wait in the bounded queue
+    for (int32_t windowId = 1; windowId <= 6; ++windowId) {
+        batcher->Post(SelectionNotifyEvent::FromFocusChange(MakeFocusInfo(windowId)));
+    }
+    firstSent.set_value();
+    sender.join();
+
+    ASSERT_EQ(batches.size(), 2);
+    ASSERT_EQ(batches[1].events.size(), capacity);
+    EXPECT_EQ(batches[1].events.front().windowId, 3);
+    EXPECT_EQ(batches[1].events.back().windowId, 6);
+    SelectionNotifyStats stats = batcher->GetStats();
+    EXPECT_EQ(stats.events, 7);
+    EXPECT_EQ(stats.dropped, 2);
+}
+} // namespace SelectionFwk
+} // namespace OHOS
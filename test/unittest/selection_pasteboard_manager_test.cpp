@@ -13,10 +13,12 @@
  * limitations under the License.
  */
 
+#include <thread>
 #include "gtest/gtest.h"
 
 #include "selection_pasteboard_manager.h"
 #include "selection_errors.h"
+#include "selection_whitespace.h"
 
 namespace OHOS::SelectionFwk {
 
@@ -306,4 +308,190 @@ HWTEST_F(SelectionPasteboardManagerTest, SelectionPasteboardManager024, TestSize
     ASSERT_FALSE(observer.IsAllWhitespace(std::string("\xE0\xA0 ")));
 }
 
+/**
+ * @tc.name: SelectionPasteboardManager025
+ * @tc.desc: test pasteboard text is routed to the request with the matching id
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionPasteboardManagerTest, SelectionPasteboardManager025, TestSize.Level0)
+{
+    std::shared_ptr<SelectionPasteboardManager> manager = std::make_shared<SelectionPasteboardManager>();
+    auto first = manager->CreateRequest();
+    auto second = manager->CreateRequest();
+    ASSERT_NE(first->GetId(), second->GetId());
+
+    SelectionPasteboardDisposableObserver observer;
+    observer.SetRequest(second->GetId(), manager);
+    observer.OnTextReceived("second", 0);
+    ASSERT_TRUE(second->WaitFor(std::chrono::milliseconds(0)));
+    ASSERT_FALSE(first->WaitFor(std::chrono::milliseconds(0)));
+    ASSERT_EQ(second->GetResult().text, "second");
+
+    manager->OnTextReceived(first->GetId(), "first", 0);
+    ASSERT_TRUE(first->WaitFor(std::chrono::milliseconds(0)));
+    ASSERT_EQ(first->GetResult().text, "first");
+}
+
+/**
+ * @tc.name: SelectionPasteboardManager026
+ * @tc.desc: test late pasteboard text of a finished request is dropped
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionPasteboardManagerTest, SelectionPasteboardManager026, TestSize.Level0)
+{
+    std::shared_ptr<SelectionPasteboardManager> manager = std::make_shared<SelectionPasteboardManager>();
+    auto stale = manager->CreateRequest();
+    manager->RemoveRequest(stale->GetId());
+    auto current = manager->CreateRequest();
+
+    manager->OnTextReceived(stale->GetId(), "stale", 0);
+    ASSERT_FALSE(stale->WaitFor(std::chrono::milliseconds(0)));
+    ASSERT_FALSE(current->WaitFor(std::chrono::milliseconds(0)));
+
+    SelectionPasteboardResult result;
+    result.text = "current";
+    ASSERT_TRUE(current->Complete(result));
+    result.text = "again";
+    ASSERT_FALSE(current->Complete(result));
+    ASSERT_EQ(current->GetResult().text, "current");
+}
+
+/**
+ * @tc.name: SelectionPasteboardManager027
+ * @tc.desc: test inject latency histogram buckets samples by upper bound
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionPasteboardManagerTest, SelectionPasteboardManager027, TestSize.Level0)
+{
+    SelectionInjectLatencyHistogram histogram;
+    histogram.Record(-1);
+    histogram.Record(10000);
+    histogram.Record(10001);
+    histogram.Record(200000);
+
+    auto buckets = histogram.GetBuckets();
+    ASSERT_EQ(buckets[0], 2);
+    ASSERT_EQ(buckets[1], 1);
+    ASSERT_EQ(buckets[INJECT_LATENCY_BUCKET_COUNT - 1], 1);
+    ASSERT_EQ(histogram.GetCount(), 4);
+    ASSERT_EQ(histogram.GetTotalUs(), 220001);
+    ASSERT_EQ(histogram.GetMaxUs(), 200000);
+}
+
+/**
+ * @tc.name: SelectionPasteboardManager028
+ * @tc.desc: test pasteboard callback after injection records inject latency
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionPasteboardManagerTest, SelectionPasteboardManager028, TestSize.Level0)
+{
+    std::shared_ptr<SelectionPasteboardManager> manager = std::make_shared<SelectionPasteboardManager>();
+    auto notInjected = manager->CreateRequest();
+    manager->OnTextReceived(notInjected->GetId(), "text", 0);
+    ASSERT_EQ(manager->injectLatency_.GetCount(), 0);
+
+    auto injected = manager->CreateRequest();
+    injected->MarkInjected(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+    manager->OnTextReceived(injected->GetId(), "text", 0);
+    ASSERT_EQ(manager->injectLatency_.GetCount(), 1);
+}
+
+/**
+ * @tc.name: SelectionPasteboardManager029
+ * @tc.desc: test inject task is rejected when the inject worker is not running
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionPasteboardManagerTest, SelectionPasteboardManager029, TestSize.Level0)
+{
+    std::shared_ptr<SelectionPasteboardManager> manager = std::make_shared<SelectionPasteboardManager>();
+    ASSERT_FALSE(manager->PostInjectTask(1));
+    ASSERT_EQ(manager->injectDropped_.load(), 1);
+}
+
+/**
+ * @tc.name: SelectionPasteboardManager030
+ * @tc.desc: test IsAllWhitespace with format characters and overlong UTF-8 encodings
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionPasteboardManagerTest, SelectionPasteboardManager030, TestSize.Level0)
+{
+    SelectionPasteboardDisposableObserver observer;
+
+    ASSERT_TRUE(observer.IsAllWhitespace(u8"\u200B\u2066\u2069\uFEFF"));
+    ASSERT_TRUE(observer.IsAllWhitespace(u8"\u0085\u00AD \u3000"));
+    ASSERT_FALSE(observer.IsAllWhitespace(u8"\u3000\u3001"));
+    ASSERT_FALSE(observer.IsAllWhitespace(std::string("\xC0\xA0")));
+    ASSERT_FALSE(observer.IsAllWhitespace(std::string("\xE0\x80\xA0")));
+    ASSERT_FALSE(observer.IsAllWhitespace(std::string("\xE3\x41\x80")));
+    ASSERT_FALSE(observer.IsAllWhitespace(std::string(1, '\0')));
+}
+
+/**
+ * @tc.name: SelectionPasteboardManager032
+ * @tc.desc: test DecodeUtf8 rejects surrogate code points and code points above U+10FFFF
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionPasteboardManagerTest, SelectionPasteboardManager032, TestSize.Level0)
+{
+    uint32_t codePoint = 0;
+    // Boundaries around the surrogate range are still valid
+    EXPECT_EQ(DecodeUtf8("\xED\x9F\xBF", 0, codePoint), 3);
+    EXPECT_EQ(codePoint, 0xD7FF);
+    EXPECT_EQ(DecodeUtf8("\xEE\x80\x80", 0, codePoint), 3);
+    EXPECT_EQ(codePoint, 0xE000);
+    EXPECT_EQ(DecodeUtf8("\xF4\x8F\xBF\xBF", 0, codePoint), 4);
+    EXPECT_EQ(codePoint, 0x10FFFF);
+
+    // U+D800, U+DBFF, U+DC00 and U+DFFF encoded as three bytes
+    EXPECT_EQ(DecodeUtf8("\xED\xA0\x80", 0, codePoint), 0);
+    EXPECT_EQ(DecodeUtf8("\xED\xAF\xBF", 0, codePoint), 0);
+    EXPECT_EQ(DecodeUtf8("\xED\xB0\x80", 0, codePoint), 0);
+    EXPECT_EQ(DecodeUtf8("\xED\xBF\xBF", 0, codePoint), 0);
+    // U+110000 and the largest four-byte sequence
+    EXPECT_EQ(DecodeUtf8("\xF4\x90\x80\x80", 0, codePoint), 0);
+    EXPECT_EQ(DecodeUtf8("\xF7\xBF\xBF\xBF", 0, codePoint), 0);
+
+    SelectionPasteboardDisposableObserver observer;
+    ASSERT_FALSE(observer.IsAllWhitespace(std::string("\xE3\x80\x80\xED\xA0\x80")));
+}
+
+/**
+ * @tc.name: SelectionPasteboardManager031
+ * @tc.desc: test the pasteboard wait budget starts when the request is injected, not when it is queued
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionPasteboardManagerTest, SelectionPasteboardManager031, TestSize.Level0)
+{
+    constexpr auto queueDelay = std::chrono::milliseconds(60);
+    constexpr auto responseDelay = std::chrono::milliseconds(5);
+    constexpr auto waitBudget = std::chrono::milliseconds(40);
+    std::shared_ptr<SelectionPasteboardManager> manager = std::make_shared<SelectionPasteboardManager>();
+    auto idle = manager->CreateRequest();
+    ASSERT_FALSE(idle->WaitForResponse(std::chrono::microseconds(0), waitBudget));
+
+    // The request stays queued longer than the wait budget and is still served
+    auto request = manager->CreateRequest();
+    std::thread injector([request, queueDelay, responseDelay]() {
+        std::this_thread::sleep_for(queueDelay);
+        request->MarkInjected(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+        std::this_thread::sleep_for(responseDelay);
+        SelectionPasteboardResult result;
+        result.text = "text";
+        request->Complete(std::move(result));
+    });
+    EXPECT_TRUE(request->WaitForResponse(std::chrono::seconds(1), waitBudget));
+    injector.join();
+    EXPECT_EQ(request->GetResult().text, "text");
+
+    // A request completed before injection (e.g. cancelled) returns without waiting for the queue timeout
+    auto cancelled = manager->CreateRequest();
+    SelectionPasteboardResult result;
+    result.cancelled = true;
+    cancelled->Complete(std::move(result));
+    EXPECT_TRUE(cancelled->WaitForResponse(std::chrono::seconds(1), waitBudget));
+    EXPECT_TRUE(cancelled->GetResult().cancelled);
+}
+
 } // namespace OHOS::SelectionFwk
@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <dlfcn.h>
 #include <optional>
 
 #include "gtest/gtest.h"
@@ -446,20 +447,20 @@ HWTEST_F(SelectionServiceTest, SelectionService017, TestSize.Level0)
 {
     sptr<Rosen::FocusChangeInfo> focusChangeInfo;
 
-    auto listener = SelectionService::GetInstance()->listener_;
-    SelectionService::GetInstance()->listener_ = nullptr;
+    auto& registry = SelectionService::GetInstance()->listenerRegistry_;
+    registry.Clear();
     SelectionService::GetInstance()->HandleFocusChanged(focusChangeInfo, true);
 
     auto remote = GetSelectionSystemAbility();
     sptr<ISelectionListener> selectionListener = iface_cast<ISelectionListener>(remote);
     ASSERT_NE(selectionListener, nullptr);
-    SelectionService::GetInstance()->listener_ = selectionListener;
+    registry.Add(selectionListener, SELECTION_EVENT_MASK_ALL, -1);
     SelectionService::GetInstance()->HandleFocusChanged(focusChangeInfo, false);
 
     focusChangeInfo = new Rosen::FocusChangeInfo();
     ASSERT_NE(focusChangeInfo, nullptr);
     SelectionService::GetInstance()->HandleFocusChanged(focusChangeInfo, true);
-    SelectionService::GetInstance()->listener_ = listener;
+    registry.Clear();
 }
 
 /**
@@ -585,5 +586,336 @@ HWTEST_F(SelectionServiceTest, SelectionService028, TestSize.Level0)
     int ret = SelectionService::GetInstance()->GetCurrentSelectionAppInfo(bundleName, abilityName);
     ASSERT_EQ(ret, -1);
 }
+
+/**
+ * @tc.name: SelectionService029
+ * @tc.desc: test prewarm disabled by zero idle timeout and waiting without prewarm
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionServiceTest, SelectionService029, TestSize.Level0)
+{
+    std::cout << "SelectionService029 start" << std::endl;
+    auto service = SelectionService::GetInstance();
+    service->prewarmFuture_ = std::shared_future<int32_t>();
+    int32_t idleTimeout = service->prewarmIdleTimeoutMs_.load();
+    service->prewarmIdleTimeoutMs_.store(0);
+    service->PrewarmExtAbility();
+    EXPECT_FALSE(service->prewarmFuture_.valid());
+    EXPECT_EQ(service->WaitPrewarmedExtAbility(), -1);
+    service->prewarmIdleTimeoutMs_.store(idleTimeout);
+}
+
+/**
+ * @tc.name: SelectionService030
+ * @tc.desc: test prewarm with invalid app info completes and is consumed by selection
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionServiceTest, SelectionService030, TestSize.Level0)
+{
+    std::cout << "SelectionService030 start" << std::endl;
+    auto service = SelectionService::GetInstance();
+    MemSelectionConfig::GetInstance().SetEnabled(true);
+    MemSelectionConfig::GetInstance().SetApplicationInfo("");
+    service->prewarmFuture_ = std::shared_future<int32_t>();
+    uint64_t usedCount = service->prewarmUsedCount_.load();
+    service->PrewarmExtAbility();
+    ASSERT_TRUE(service->prewarmFuture_.valid());
+    EXPECT_EQ(service->WaitPrewarmedExtAbility(), -1);
+    EXPECT_EQ(service->prewarmUsedCount_.load(), usedCount + 1);
+    EXPECT_FALSE(service->isPrewarmPending_);
+    EXPECT_EQ(service->prewarmIdleTimerId_.load(), 0);
+}
+
+/**
+ * @tc.name: SelectionService031
+ * @tc.desc: test prefetched content is returned only for the matching selection sequence id
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionServiceTest, SelectionService031, TestSize.Level0)
+{
+    std::cout << "SelectionService031 start" << std::endl;
+    auto service = SelectionService::GetInstance();
+    bool prefetchEnabled = service->contentPrefetchEnabled_.load();
+    service->contentPrefetchEnabled_.store(false);
+    service->PrefetchSelectionContent(1, 0, "com.example.selection", SelectionPluginPoint {});
+    EXPECT_FALSE(service->prefetchFuture_.valid());
+
+    std::promise<std::pair<int32_t, std::string>> promise;
+    promise.set_value(std::make_pair(0, std::string("prefetched")));
+    service->prefetchSeqId_ = 2;
+    service->prefetchFuture_ = promise.get_future().share();
+    std::string content;
+    int32_t result = -1;
+    EXPECT_FALSE(service->TakePrefetchedContent(3, content, result));
+    EXPECT_TRUE(service->TakePrefetchedContent(2, content, result));
+    EXPECT_EQ(result, 0);
+    EXPECT_EQ(content, "prefetched");
+    EXPECT_FALSE(service->TakePrefetchedContent(2, content, result));
+    service->contentPrefetchEnabled_.store(prefetchEnabled);
+}
+
+/**
+ * @tc.name: SelectionService032
+ * @tc.desc: test plugin modules are loaded and unloaded independently
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionServiceTest, SelectionService032, TestSize.Level0)
+{
+    std::cout << "SelectionService032 start" << std::endl;
+    auto service = SelectionService::GetInstance();
+    service->UnloadPluginSo();
+    for (const auto& plugin : service->plugins_) {
+        EXPECT_EQ(plugin.Current(), nullptr);
+    }
+
+    bool loaded = service->LoadPluginSo(SelectionService::PLUGIN_PASTEBOARD);
+    EXPECT_EQ(service->plugins_[SelectionService::PLUGIN_PASTEBOARD].Current() != nullptr, loaded);
+    EXPECT_EQ(service->plugins_[SelectionService::PLUGIN_PASTEBOARD].GetApi() != nullptr, loaded);
+    EXPECT_EQ(service->plugins_[SelectionService::PLUGIN_DATABASE].Current(), nullptr);
+    EXPECT_EQ(service->plugins_[SelectionService::PLUGIN_ABILITY_MANAGER].Current(), nullptr);
+
+    service->UnloadPluginSo(SelectionService::PLUGIN_PASTEBOARD);
+    EXPECT_EQ(service->plugins_[SelectionService::PLUGIN_PASTEBOARD].Current(), nullptr);
+}
+
+/**
+ * @tc.name: SelectionService033
+ * @tc.desc: test hot-path plugin calls read the published api table and release their reader slot
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionServiceTest, SelectionService033, TestSize.Level0)
+{
+    std::cout << "SelectionService033 start" << std::endl;
+    static int fakeFlag = 0;
+    static const SelectionPluginApi fakeApi = [] {
+        SelectionPluginApi table {};
+        table.abiVersion = SELECTION_PLUGIN_API_VERSION;
+        table.structSize = sizeof(SelectionPluginApi);
+        table.capabilities = SELECTION_PLUGIN_CAP_PASTEBOARD;
+        table.pasteboardCanGetContent = []() { return fakeFlag; };
+        table.pasteboardSetFlag = [](int flag) { fakeFlag = flag; };
+        return table;
+    }();
+    auto service = SelectionService::GetInstance();
+    service->UnloadPluginSo(SelectionService::PLUGIN_PASTEBOARD);
+    auto& plugin = service->plugins_[SelectionService::PLUGIN_PASTEBOARD];
+    auto generation = std::make_shared<SelectionService::PluginGeneration>(nullptr, &fakeApi);
+    std::atomic_store(&plugin.generation, generation);
+
+    service->SetPasteboardFlag(true);
+    EXPECT_TRUE(service->CanGetPasteboardContent());
+    service->SetPasteboardFlag(false);
+    EXPECT_FALSE(service->CanGetPasteboardContent());
+    EXPECT_EQ(generation->readers.load(), 0);
+
+    // The generation is unpublished even when no handle was opened
+    service->UnloadPluginSo(SelectionService::PLUGIN_PASTEBOARD);
+    EXPECT_EQ(plugin.Current(), nullptr);
+    SelectionService::PluginApiGuard guard(plugin);
+    EXPECT_FALSE(guard);
+    EXPECT_EQ(generation->readers.load(), 0);
+}
+
+/**
+ * @tc.name: SelectionService034
+ * @tc.desc: test plugin unload returns immediately and reclaims only after in-flight calls finish
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionServiceTest, SelectionService034, TestSize.Level0)
+{
+    std::cout << "SelectionService034 start" << std::endl;
+    static std::atomic<int32_t> cleanupCount {0};
+    static const SelectionPluginApi fakeApi = [] {
+        SelectionPluginApi table {};
+        table.abiVersion = SELECTION_PLUGIN_API_VERSION;
+        table.structSize = sizeof(SelectionPluginApi);
+        table.capabilities = SELECTION_PLUGIN_CAP_PASTEBOARD;
+        table.cleanup = []() { cleanupCount.fetch_add(1); };
+        return table;
+    }();
+    auto service = SelectionService::GetInstance();
+    service->UnloadPluginSo(SelectionService::PLUGIN_PASTEBOARD);
+    service->WaitPluginSoReclaimed();
+    auto& plugin = service->plugins_[SelectionService::PLUGIN_PASTEBOARD];
+    void* handle = dlopen(nullptr, RTLD_LAZY);
+    ASSERT_NE(handle, nullptr);
+    auto generation = std::make_shared<SelectionService::PluginGeneration>(handle, &fakeApi);
+    std::atomic_store(&plugin.generation, generation);
+
+    {
+        SelectionService::PluginApiGuard inFlight(plugin);
+        ASSERT_TRUE(inFlight);
+        service->UnloadPluginSo(SelectionService::PLUGIN_PASTEBOARD);
+        EXPECT_EQ(plugin.Current(), nullptr);
+        ASSERT_TRUE(plugin.reclaimFuture.valid());
+        EXPECT_EQ(plugin.reclaimFuture.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+        EXPECT_EQ(cleanupCount.load(), 0);
+    }
+    service->WaitPluginSoReclaimed();
+    EXPECT_FALSE(plugin.reclaimFuture.valid());
+    EXPECT_EQ(cleanupCount.load(), 1);
+    EXPECT_EQ(generation->readers.load(), 0);
+}
+
+/**
+ * @tc.name: SelectionService035
+ * @tc.desc: test keep-alive only refreshes the last-used time and the reaper unloads idle modules
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionServiceTest, SelectionService035, TestSize.Level0)
+{
+    std::cout << "SelectionService035 start" << std::endl;
+    static const SelectionPluginApi fakeApi = [] {
+        SelectionPluginApi table {};
+        table.abiVersion = SELECTION_PLUGIN_API_VERSION;
+        table.structSize = sizeof(SelectionPluginApi);
+        table.capabilities = SELECTION_PLUGIN_CAP_PASTEBOARD;
+        return table;
+    }();
+    auto service = SelectionService::GetInstance();
+    service->UnloadPluginSo(SelectionService::PLUGIN_PASTEBOARD);
+    service->WaitPluginSoReclaimed();
+    auto& plugin = service->plugins_[SelectionService::PLUGIN_PASTEBOARD];
+    std::atomic_store(&plugin.generation, std::make_shared<SelectionService::PluginGeneration>(nullptr, &fakeApi));
+    int64_t idleSince = SelectionService::GetPluginClockMs() - SelectionService::PLUGIN_UNLOAD_TIMEOUT_MS - 1;
+    plugin.lastUsedMs.store(idleSince);
+
+    service->KeepPluginsAlive();
+    EXPECT_GT(plugin.lastUsedMs.load(), idleSince);
+    service->OnPluginReaperTick();
+    EXPECT_EQ(plugin.GetApi(), &fakeApi);
+
+    plugin.lastUsedMs.store(idleSince);
+    service->StartPluginReaper();
+    if (service->IsAnySelectionPanelShowing()) {
+        service->UnloadPluginSo(SelectionService::PLUGIN_PASTEBOARD);
+    } else {
+        service->OnPluginReaperTick();
+    }
+    EXPECT_EQ(plugin.Current(), nullptr);
+    bool anyLoaded = false;
+    for (const auto& module : service->plugins_) {
+        anyLoaded = anyLoaded || module.Current() != nullptr;
+    }
+    if (!anyLoaded) {
+        service->OnPluginReaperTick();
+    }
+    EXPECT_EQ(service->pluginReaperTimerId_ != 0, anyLoaded);
+    service->StopPluginReaper();
+}
+
+/**
+ * @tc.name: SelectionService036
+ * @tc.desc: test a moved plugin api guard keeps exactly one reader slot
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionServiceTest, SelectionService036, TestSize.Level0)
+{
+    std::cout << "SelectionService036 start" << std::endl;
+    static const SelectionPluginApi fakeApi = [] {
+        SelectionPluginApi table {};
+        table.abiVersion = SELECTION_PLUGIN_API_VERSION;
+        table.structSize = sizeof(SelectionPluginApi);
+        table.capabilities = SELECTION_PLUGIN_CAP_PASTEBOARD;
+        return table;
+    }();
+    auto service = SelectionService::GetInstance();
+    service->UnloadPluginSo(SelectionService::PLUGIN_PASTEBOARD);
+    service->WaitPluginSoReclaimed();
+    auto& plugin = service->plugins_[SelectionService::PLUGIN_PASTEBOARD];
+    auto generation = std::make_shared<SelectionService::PluginGeneration>(nullptr, &fakeApi);
+    std::atomic_store(&plugin.generation, generation);
+
+    {
+        SelectionService::PluginApiGuard first(plugin);
+        SelectionService::PluginApiGuard second(std::move(first));
+        EXPECT_TRUE(second);
+        EXPECT_EQ(generation->readers.load(), 1);
+        EXPECT_TRUE(SelectionService::PluginApiGuard::IsHeldByCurrentThread(generation.get()));
+    }
+    EXPECT_EQ(generation->readers.load(), 0);
+    EXPECT_FALSE(SelectionService::PluginApiGuard::IsHeldByCurrentThread(generation.get()));
+    {
+        auto api = service->AcquirePluginApi(SelectionService::PLUGIN_PASTEBOARD);
+        EXPECT_TRUE(api);
+        EXPECT_EQ(generation->readers.load(), 1);
+    }
+    EXPECT_EQ(generation->readers.load(), 0);
+    service->UnloadPluginSo(SelectionService::PLUGIN_PASTEBOARD);
+    EXPECT_EQ(plugin.Current(), nullptr);
+}
+
+/**
+ * @tc.name: SelectionService037
+ * @tc.desc: test a stale prewarm idle timer callback does not clear the id of a newer timer
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionServiceTest, SelectionService037, TestSize.Level0)
+{
+    std::cout << "SelectionService037 start" << std::endl;
+    auto service = SelectionService::GetInstance();
+    service->CancelPrewarmIdleTimer();
+    constexpr uint32_t currentTimerId = 777;
+    service->prewarmIdleTimerId_.store(currentTimerId);
+
+    service->OnPrewarmIdleTimer(std::make_shared<uint32_t>(currentTimerId + 1));
+    EXPECT_EQ(service->prewarmIdleTimerId_.load(), currentTimerId);
+    service->OnPrewarmIdleTimer(std::make_shared<uint32_t>(0));
+    EXPECT_EQ(service->prewarmIdleTimerId_.load(), currentTimerId);
+
+    bool isPrewarmPending = service->isPrewarmPending_;
+    service->isPrewarmPending_ = false;
+    service->OnPrewarmIdleTimer(std::make_shared<uint32_t>(currentTimerId));
+    EXPECT_EQ(service->prewarmIdleTimerId_.load(), 0);
+    service->isPrewarmPending_ = isPrewarmPending;
+}
+
+/**
+ * @tc.name: SelectionService038
+ * @tc.desc: test reclaim of an old plugin generation waits only for its own readers
+ * @tc.type: FUNC
+ */
+HWTEST_F(SelectionServiceTest, SelectionService038, TestSize.Level0)
+{
+    std::cout << "SelectionService038 start" << std::endl;
+    static std::atomic<int32_t> cleanupCount {0};
+    static const SelectionPluginApi fakeApi = [] {
+        SelectionPluginApi table {};
+        table.abiVersion = SELECTION_PLUGIN_API_VERSION;
+        table.structSize = sizeof(SelectionPluginApi);
+        table.capabilities = SELECTION_PLUGIN_CAP_PASTEBOARD;
+        table.cleanup = []() { cleanupCount.fetch_add(1); };
+        return table;
+    }();
+    auto service = SelectionService::GetInstance();
+    service->UnloadPluginSo(SelectionService::PLUGIN_PASTEBOARD);
+    service->WaitPluginSoReclaimed();
+    auto& plugin = service->plugins_[SelectionService::PLUGIN_PASTEBOARD];
+    void* handle = dlopen(nullptr, RTLD_LAZY);
+    ASSERT_NE(handle, nullptr);
+    auto oldGeneration = std::make_shared<SelectionService::PluginGeneration>(handle, &fakeApi);
+    std::atomic_store(&plugin.generation, oldGeneration);
+
+    auto oldGuard = std::make_unique<SelectionService::PluginApiGuard>(plugin);
+    ASSERT_TRUE(*oldGuard);
+    service->UnloadPluginSo(SelectionService::PLUGIN_PASTEBOARD);
+    // Loading on a thread that still holds the old generation fails instead of waiting for its own reclaim
+    EXPECT_FALSE(service->LoadPluginSo(SelectionService::PLUGIN_PASTEBOARD));
+
+    auto newGeneration = std::make_shared<SelectionService::PluginGeneration>(nullptr, &fakeApi);
+    std::atomic_store(&plugin.generation, newGeneration);
+    SelectionService::PluginApiGuard newGuard(plugin);
+    ASSERT_TRUE(newGuard);
+    EXPECT_EQ(oldGeneration->readers.load(), 1);
+    EXPECT_EQ(newGeneration->readers.load(), 1);
+
+    oldGuard.reset();
+    ASSERT_TRUE(plugin.reclaimFuture.valid());
+    EXPECT_EQ(plugin.reclaimFuture.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+    EXPECT_EQ(cleanupCount.load(), 1);
+    EXPECT_EQ(newGeneration->readers.load(), 1);
+    std::atomic_store(&plugin.generation, std::shared_ptr<SelectionService::PluginGeneration>());
+    service->WaitPluginSoReclaimed();
+}
+}
 }
-}
\ No newline at end of file
@@ -43,6 +43,7 @@ enum SelectionServiceError {
     CANNOT_GET_CONTENT,
     CONTENT_OUT_OF_RANGE,
     GET_CONTENT_TIMEOUT,
+    LISTENER_LIMIT_EXCEEDED,
 };
 
 // 插件加载相关错误码